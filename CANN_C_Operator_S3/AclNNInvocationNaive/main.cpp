@@ -13,7 +13,7 @@
 #include <vector>
 
 #include "acl/acl.h"
-#include "aclnn_reduce_custom.h"
+#include "aclnn_arg_max_with_value.h"
 
 #define SUCCESS 0
 #define FAILED 1
@@ -141,19 +141,27 @@ int main(int argc, char **argv)
     uint64_t workspaceSize = 0;
     aclOpExecutor *executor;
     // Calculate the workspace size and allocate memory for it
-    // Calculate the workspace size and allocate memory for it
-    ret = aclnnArgMaxWithValueGetWorkspaceSize(inputX, outputMaxIndex, outputMaxValue, &workspaceSize, &executor);
+    // x 连续，x_strides 传空；转置等视图可按元素填入各维 stride，算子直接按视图读取
+    // axes 为空时沿 dimension 归约
+    aclIntArray *xStrides = aclCreateIntArray(nullptr, 0);
+    aclIntArray *axes = aclCreateIntArray(nullptr, 0);
+    ret = aclnnArgMaxWithValueGetWorkspaceSize(inputX, 0, false, false, xStrides, axes, outputMaxIndex, outputMaxValue,
+                                               &workspaceSize, &executor);
     CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclnnArgMaxWithValueGetWorkspaceSize failed. ERROR: %d\n", ret);
+              aclDestroyIntArray(xStrides); aclDestroyIntArray(axes);
               DestroyResources(tensors, deviceAddrs, stream, deviceId); return FAILED);
 
     void *workspaceAddr = nullptr;
     if (workspaceSize > 0) {
         ret = aclrtMalloc(&workspaceAddr, workspaceSize, ACL_MEM_MALLOC_HUGE_FIRST);
         CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("allocate workspace failed. ERROR: %d\n", ret);
+                  aclDestroyIntArray(xStrides); aclDestroyIntArray(axes);
                   DestroyResources(tensors, deviceAddrs, stream, deviceId, workspaceAddr); return FAILED);
     }
     // Execute the arg_max_with_value custom operator
     ret = aclnnArgMaxWithValue(workspaceAddr, workspaceSize, executor, stream);
+    aclDestroyIntArray(xStrides);
+    aclDestroyIntArray(axes);
     CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclnnArgMaxWithValue failed. ERROR: %d\n", ret);
               DestroyResources(tensors, deviceAddrs, stream, deviceId, workspaceAddr); return FAILED);
 
@@ -16,8 +16,8 @@ rights reserved.
 
 namespace domi {
 // register op info to GE
-REGISTER_CUSTOM_OP("ArgMaxWithValue")
+REGISTER_CUSTOM_OP("SinhCustom")
     .FrameworkType(TENSORFLOW)   // type: CAFFE, TENSORFLOW
-    .OriginOpType("ArgMaxWithValue")      // name in tf module
+    .OriginOpType("SinhCustom")      // name in tf module
     .ParseParamsByOperatorFn(AutoMappingByOpFn);
 }  // namespace domi
@@ -1,16 +1,100 @@
 
+#include <algorithm>
+#include <cstring>
 #include "sinh_custom_tiling.h"
 #include "register/op_def_registry.h"
+#include "tiling/platform/platform_ascendc.h"
 
 
 namespace optiling {
-constexpr int32_t BLOCK_DIM = 8;
+constexpr uint32_t BLOCK_SIZE = 32;
+// tile 按 256 个元素对齐：float 计算时为整数个 256B repeat，两份掩码按字节切分后仍 32B 对齐
+constexpr uint32_t TILE_ALIGN = 256;
+constexpr uint32_t BUFFER_NUM = 2;
+// 核内统一按 float 计算：x 的 float 副本与五份中间结果
+constexpr uint32_t CALC_COPIES = 6;
+// 多项式与指数形式的两份比较掩码，每个元素各占 1 bit
+constexpr uint32_t MASK_BITS = 2;
+// 每核至少处理的字节数，数据量小时少用几个核，避免启动开销大于计算
+constexpr uint32_t MIN_BLOCK_BYTES = 8 * 1024;
+
+static uint32_t CeilDiv(uint32_t value, uint32_t factor)
+{
+    return (value + factor - 1) / factor;
+}
+
+// mode 的各位，tiling key 即 mode
+constexpr uint32_t MODE_SINH = 1;
+constexpr uint32_t MODE_COSH = 2;
+constexpr uint32_t MODE_TANH = 4;
+constexpr uint32_t MODE_BITS = 3;
+
+// mode 为逗号分隔的 "sinh" / "cosh" / "tanh"，如 "sinh,cosh"；出现未知名称或为空时返回 0
+static uint32_t ParseMode(const char *mode)
+{
+    static const char *const NAMES[MODE_BITS] = {"sinh", "cosh", "tanh"};
+    uint32_t bits = 0;
+    while (*mode != '\0') {
+        size_t len = strcspn(mode, ",");
+        uint32_t bit = 0;
+        for (uint32_t i = 0; i < MODE_BITS; i++) {
+            if (len == strlen(NAMES[i]) && strncmp(mode, NAMES[i], len) == 0) {
+                bit = 1U << i;
+            }
+        }
+        if (bit == 0) {
+            return 0;
+        }
+        bits |= bit;
+        mode += mode[len] == ',' ? len + 1 : len;
+    }
+    return bits;
+}
+
 static ge::graphStatus TilingFunc(gert::TilingContext* context)
 {
-    ArgMaxWithValueTilingData tiling;
-    uint32_t total_len = context->GetInputShape(0)->GetOriginShape().GetShapeSize();
-    context->SetBlockDim(BLOCK_DIM);
-    tiling.set_total_len(total_len);
+    SinhCustomTilingData tiling;
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    uint32_t total_length = context->GetInputShape(0)->GetStorageShape().GetShapeSize();
+    ge::DataType dtype = context->GetInputDesc(0)->GetDataType();
+    uint32_t type_size = dtype == ge::DT_FLOAT16 || dtype == ge::DT_BF16 ? 2 : 4;
+    uint32_t align_num = BLOCK_SIZE / type_size;
+    uint32_t mode = ParseMode(context->GetAttrs()->GetAttrPointer<char>(0));
+    if (mode == 0) {
+        return ge::GRAPH_FAILED;
+    }
+    // 选中的输出须连接，输出按 y、cosh_y、tanh_y 的顺序依次对应 mode 的各位
+    uint32_t output_num = 0;
+    for (uint32_t i = 0; i < MODE_BITS; i++) {
+        if (((mode >> i) & 1) == 0) {
+            continue;
+        }
+        if (context->GetOutputShape(i) == nullptr) {
+            return ge::GRAPH_FAILED;
+        }
+        output_num++;
+    }
+
+    // 按元素数均分到各核，每核分片 32B 对齐；
+    // 空张量时分片取一个对齐单位、只用一个核，核内 tile 数为 0，不搬运也不计算
+    uint32_t min_block = MIN_BLOCK_BYTES / type_size;
+    uint32_t core_num = std::max(1U, std::min(ascendcPlatform.GetCoreNumAiv(), CeilDiv(total_length, min_block)));
+    uint32_t block_length = std::max(align_num, CeilDiv(CeilDiv(total_length, core_num), align_num) * align_num);
+    uint32_t used_core_num = std::max(1U, CeilDiv(total_length, block_length));
+
+    uint64_t ub_size;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ub_size);
+    // 每个元素在 UB 中占用：x 与选中的各输出各双缓冲，再加 float 计算空间与掩码
+    uint32_t elem_bits = ((1 + output_num) * BUFFER_NUM * type_size + CALC_COPIES * sizeof(float)) * 8 + MASK_BITS;
+    uint32_t tile_length = ub_size * 8 / elem_bits / TILE_ALIGN * TILE_ALIGN;
+    tile_length = std::min(tile_length, block_length);
+
+    tiling.set_total_length(total_length);
+    tiling.set_block_length(block_length);
+    tiling.set_tile_length(tile_length);
+
+    context->SetTilingKey(mode);
+    context->SetBlockDim(used_core_num);
     tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
     context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
     size_t *currentWorkspace = context->GetWorkspaceSizes(1);
@@ -23,36 +107,46 @@ static ge::graphStatus TilingFunc(gert::TilingContext* context)
 namespace ge {
 static ge::graphStatus InferShape(gert::InferShapeContext* context)
 {
+    // 各输出与 x 同形，未连接的可选输出跳过
     const gert::Shape* x1_shape = context->GetInputShape(0);
-    gert::Shape* y_shape = context->GetOutputShape(0);
-    *y_shape = *x1_shape;
+    for (size_t i = 0; i < optiling::MODE_BITS; i++) {
+        gert::Shape* y_shape = context->GetOutputShape(i);
+        if (y_shape != nullptr) {
+            *y_shape = *x1_shape;
+        }
+    }
     return GRAPH_SUCCESS;
 }
 }
 
 
 namespace ops {
-class ArgMaxWithValue : public OpDef {
+class SinhCustom : public OpDef {
 public:
-    explicit ArgMaxWithValue(const char* name) : OpDef(name)
+    explicit SinhCustom(const char* name) : OpDef(name)
     {
         this->Input("x")
             .ParamType(REQUIRED)
-            .DataType({ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_INT32, ge::DT_UINT8})
-            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
-            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
-        this->Output("indices")
-            .ParamType(REQUIRED)
-            .DataType({ge::DT_INT32, ge::DT_INT32, ge::DT_INT32, ge::DT_INT32})
-            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
-            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
-        this->Output("values")
-            .ParamType(REQUIRED)
-            .DataType({ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_INT32, ge::DT_UINT8})
-            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
-            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
-        this->Attr("dimension").Int();
-        this->Attr("keep_dims").AttrType(OPTIONAL).Bool(false);
+            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Output("y")
+            .ParamType(OPTIONAL)
+            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Output("cosh_y")
+            .ParamType(OPTIONAL)
+            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Output("tanh_y")
+            .ParamType(OPTIONAL)
+            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        // 选择计算哪些输出：y 为 sinh，cosh_y / tanh_y 为 cosh 与 tanh；三个输出均可选，mode 选中的输出须连接
+        this->Attr("mode").AttrType(OPTIONAL).String("sinh");
 
         this->SetInferShape(ge::InferShape);
 
@@ -62,5 +156,5 @@ public:
     }
 };
 
-OP_ADD(ArgMaxWithValue);
+OP_ADD(SinhCustom);
 }
@@ -2,10 +2,13 @@
 #include "register/tilingdata_base.h"
 
 namespace optiling {
-BEGIN_TILING_DATA_DEF(ArgMaxWithValueTilingData)
-  //考生自行定义tiling结构体成员变量
-TILING_DATA_FIELD_DEF(uint32_t, total_len);
+BEGIN_TILING_DATA_DEF(SinhCustomTilingData)
+  TILING_DATA_FIELD_DEF(uint32_t, total_length);
+  // 每核处理的元素数，按 32B 对齐，最后一个核处理剩余部分
+  TILING_DATA_FIELD_DEF(uint32_t, block_length);
+  // 每次搬入 UB 的元素数
+  TILING_DATA_FIELD_DEF(uint32_t, tile_length);
 END_TILING_DATA_DEF;
 
-REGISTER_TILING_DATA_CLASS(ArgMaxWithValue, ArgMaxWithValueTilingData)
+REGISTER_TILING_DATA_CLASS(SinhCustom, SinhCustomTilingData)
 }
@@ -1,54 +1,234 @@
 #include "kernel_operator.h"
 using namespace AscendC;
 constexpr int32_t BUFFER_NUM = 2;
+// 向量比较一次处理 256B，比较的元素数按此对齐
+constexpr uint32_t CMP_ALIGN = 64;
+// 计算空间按 256 个元素对齐，两份掩码按字节切分后仍 32B 对齐，与 tiling 一致
+constexpr uint32_t TILE_ALIGN = 256;
+// |x| 小于该值时取多项式，否则取指数形式
+constexpr float POLY_THRESHOLD = 1.0f;
+constexpr float LN2 = 0.693147180559945f;
+// sinh 的奇次泰勒系数 1/3!, 1/5!, 1/7!, 1/9!，|x| < 1 时截断误差约 2.5e-8
+constexpr float COEF_3 = 1.0f / 6.0f;
+constexpr float COEF_5 = 1.0f / 120.0f;
+constexpr float COEF_7 = 1.0f / 5040.0f;
+constexpr float COEF_9 = 1.0f / 362880.0f;
+// mode 的各位，与 tiling 一致，tiling key 即 mode
+constexpr uint32_t MODE_SINH = 1;
+constexpr uint32_t MODE_COSH = 2;
+constexpr uint32_t MODE_TANH = 4;
 
-template <typename T>
-class KernelArgMaxWithValue {
+// 双曲函数族，按 MODE 输出 sinh / cosh / tanh 中的若干个。
+// 每个 tile 只求一次 h = e^|x| / 2 与 r = e^-|x| / 2 = 1 / (4h)，各输出都由 UB 中的这两份中间结果得到：
+//   sinh(|x|) = h - r，cosh(x) = h + r，tanh(|x|) = 1 - 2r / (h + r)，奇函数再按 x 的符号取反。
+// |x| 接近 0 时 h - r 与 1 - 2r / (h + r) 都会抵消掉有效位，sinh 改用奇次多项式，tanh 取多项式 sinh 除以 cosh；
+// 两种形式都对整个 tile 计算，再按 |x| 的比较掩码向量选择，不引入逐元素的标量分支。
+// half 与 bf16 输入转为 float 计算后再转回。
+// 搬入、计算、搬出三段流水，x 与各输出各双缓冲，搬运与计算相互掩盖
+template <typename T, uint32_t MODE>
+class KernelHyperbolic {
 public:
-    __aicore__ inline KernelArgMaxWithValue() {}
+    __aicore__ inline KernelHyperbolic() {}
 
     // 初始化
-    __aicore__ inline void Init(GM_ADDR inputGM, GM_ADDR outputIndiceGM, GM_ADDR outputValuesGM, uint32_t len) {
-        // 设置数据总长度
-        total_length = len;
-        // 设置输入和输出全局内存
-        srcGlobal.SetGlobalBuffer((__gm__ T *)(inputGM), total_length);
-        dstIndiceGlobal.SetGlobalBuffer((__gm__ int32_t *)(outputIndiceGM), total_length);
-        dstValuesGlobal.SetGlobalBuffer((__gm__ T *)(outputValuesGM), total_length);
-    }
-
-    // 计算过程
-    __aicore__ inline void Process() {
-        // 这里我们使用简单的 for 循环来计算
-        T maxValue = srcGlobal[0];    // 初始值为第一个元素
-        int32_t maxIndex = 0;         // 初始索引为 0
-
-        // 遍历输入数据，找到最大值及其索引
-        for (int32_t i = 1; i < total_length; ++i) {
-            if (srcGlobal[i] > maxValue) {
-                maxValue = srcGlobal[i];
-                maxIndex = i;
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR sinhY, GM_ADDR coshY, GM_ADDR tanhY,
+                                const SinhCustomTilingData &tilingData)
+    {
+        tileLength = tilingData.tile_length;
+        uint32_t start = GetBlockIdx() * tilingData.block_length;
+        length = tilingData.total_length - start < tilingData.block_length ? tilingData.total_length - start
+                                                                            : tilingData.block_length;
+        // tile 不足一个对齐单位时(每核元素少)补齐，比较按对齐后的长度进行
+        tileAlign = (tileLength + TILE_ALIGN - 1) / TILE_ALIGN * TILE_ALIGN;
+        xGlobal.SetGlobalBuffer((__gm__ T *)x + start, length);
+        pipe.InitBuffer(inQueue, BUFFER_NUM, tileAlign * sizeof(T));
+        if constexpr ((MODE & MODE_SINH) != 0) {
+            sinhGlobal.SetGlobalBuffer((__gm__ T *)sinhY + start, length);
+            pipe.InitBuffer(sinhQueue, BUFFER_NUM, tileAlign * sizeof(T));
+        }
+        if constexpr ((MODE & MODE_COSH) != 0) {
+            coshGlobal.SetGlobalBuffer((__gm__ T *)coshY + start, length);
+            pipe.InitBuffer(coshQueue, BUFFER_NUM, tileAlign * sizeof(T));
+        }
+        if constexpr ((MODE & MODE_TANH) != 0) {
+            tanhGlobal.SetGlobalBuffer((__gm__ T *)tanhY + start, length);
+            pipe.InitBuffer(tanhQueue, BUFFER_NUM, tileAlign * sizeof(T));
+        }
+        // float 的 x 与五份中间结果，以及两份比较掩码
+        pipe.InitBuffer(calcBuf, 6 * tileAlign * sizeof(float));
+        pipe.InitBuffer(maskBuf, 2 * tileAlign / 8);
+    }
+
+    // 计算过程：最后一个 tile 只处理剩余元素
+    __aicore__ inline void Process()
+    {
+        uint32_t tileNum = (length + tileLength - 1) / tileLength;
+        for (uint32_t i = 0; i < tileNum; i++) {
+            uint32_t count = i == tileNum - 1 ? length - i * tileLength : tileLength;
+            CopyIn(i, count);
+            Compute(count);
+            if constexpr ((MODE & MODE_SINH) != 0) {
+                CopyOut(sinhQueue, sinhGlobal, i, count);
+            }
+            if constexpr ((MODE & MODE_COSH) != 0) {
+                CopyOut(coshQueue, coshGlobal, i, count);
             }
+            if constexpr ((MODE & MODE_TANH) != 0) {
+                CopyOut(tanhQueue, tanhGlobal, i, count);
+            }
+        }
+    }
+
+private:
+    __aicore__ inline void CopyIn(uint32_t progress, uint32_t count)
+    {
+        LocalTensor<T> xLocal = inQueue.AllocTensor<T>();
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(count * sizeof(T)), 0, 0, 0};
+        DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+        DataCopyPad(xLocal, xGlobal[progress * tileLength], copyParams, padParams);
+        inQueue.EnQue(xLocal);
+    }
+
+    __aicore__ inline void Compute(uint32_t count)
+    {
+        LocalTensor<T> xLocal = inQueue.DeQue<T>();
+        LocalTensor<float> xFloat = calcBuf.Get<float>();
+        LocalTensor<float> tmp1 = xFloat[tileAlign];
+        LocalTensor<float> hLocal = xFloat[2 * tileAlign];
+        LocalTensor<float> rLocal = xFloat[3 * tileAlign];
+        LocalTensor<float> coshLocal = xFloat[4 * tileAlign];
+        LocalTensor<float> polyLocal = xFloat[5 * tileAlign];
+        LocalTensor<uint8_t> smallMask = maskBuf.Get<uint8_t>();
+        LocalTensor<uint8_t> negMask = smallMask[tileAlign / 8];
+        // 尾 tile 的比较按 256B 对齐，多出的元素不参与写回
+        uint32_t cmpCount = (count + CMP_ALIGN - 1) / CMP_ALIGN * CMP_ALIGN;
+        if constexpr (IsSameType<T, float>::value) {
+            xFloat = xLocal;
+        } else {
+            Cast(xFloat, xLocal, RoundMode::CAST_NONE, count);
+        }
+
+        Abs(tmp1, xFloat, count);
+        CompareScalar(smallMask, tmp1, POLY_THRESHOLD, CMPMODE::LT, cmpCount);
+        CompareScalar(negMask, xFloat, 0.0f, CMPMODE::LT, cmpCount);
+
+        // h = e^|x| / 2 只需一次 Exp，且 |x| 接近上溢时不会先溢出；r = 1 / (4h)
+        Adds(tmp1, tmp1, -LN2, count);
+        Exp(hLocal, tmp1, count);
+        Duplicate(rLocal, 0.25f, count);
+        Div(rLocal, rLocal, hLocal, count);
+        Add(coshLocal, hLocal, rLocal, count);
+        if constexpr ((MODE & MODE_COSH) != 0) {
+            Emit(coshQueue, coshLocal, count, cmpCount);
+        }
+        if constexpr ((MODE & (MODE_SINH | MODE_TANH)) != 0) {
+            // 多项式：x * (1 + x^2 * (c3 + x^2 * (c5 + x^2 * (c7 + x^2 * c9))))
+            Mul(tmp1, xFloat, xFloat, count);
+            Muls(polyLocal, tmp1, COEF_9, count);
+            Adds(polyLocal, polyLocal, COEF_7, count);
+            Mul(polyLocal, polyLocal, tmp1, count);
+            Adds(polyLocal, polyLocal, COEF_5, count);
+            Mul(polyLocal, polyLocal, tmp1, count);
+            Adds(polyLocal, polyLocal, COEF_3, count);
+            Mul(polyLocal, polyLocal, tmp1, count);
+            Adds(polyLocal, polyLocal, 1.0f, count);
+            Mul(polyLocal, polyLocal, xFloat, count);
+        }
+        if constexpr ((MODE & MODE_SINH) != 0) {
+            // h 之后不再使用，原地得到 sinh(|x|)
+            Sub(hLocal, hLocal, rLocal, count);
+            SelectOdd(hLocal, polyLocal, hLocal, tmp1, smallMask, negMask, count);
+            Emit(sinhQueue, hLocal, count, cmpCount);
+        }
+        if constexpr ((MODE & MODE_TANH) != 0) {
+            // h 为 inf 时 r 为 0，大 |x| 处 tanh 正确饱和为 1
+            Div(rLocal, rLocal, coshLocal, count);
+            Muls(rLocal, rLocal, -2.0f, count);
+            Adds(rLocal, rLocal, 1.0f, count);
+            Div(polyLocal, polyLocal, coshLocal, count);
+            SelectOdd(rLocal, polyLocal, rLocal, tmp1, smallMask, negMask, count);
+            Emit(tanhQueue, rLocal, count, cmpCount);
         }
+        inQueue.FreeTensor(xLocal);
+    }
+
+    // 小 |x| 取已带符号的多项式结果，否则取 |x| 处的值并按 x 的符号取反，结果写回 absLocal
+    __aicore__ inline void SelectOdd(LocalTensor<float> &absLocal, LocalTensor<float> &smallLocal,
+                                     LocalTensor<float> &bigLocal, LocalTensor<float> &tmpLocal,
+                                     LocalTensor<uint8_t> &smallMask, LocalTensor<uint8_t> &negMask, uint32_t count)
+    {
+        Muls(tmpLocal, bigLocal, -1.0f, count);
+        Select(absLocal, negMask, tmpLocal, bigLocal, SELMODE::VSEL_TENSOR_TENSOR_MODE, count);
+        Select(absLocal, smallMask, smallLocal, absLocal, SELMODE::VSEL_TENSOR_TENSOR_MODE, count);
+    }
 
-        // 将计算结果存储到输出数据
-        dstValuesGlobal[0] = maxValue;
-        dstIndiceGlobal[0] = maxIndex;
+    // float 结果转为输出类型后入队；float 输出按 32B 对齐的长度整块拷贝
+    __aicore__ inline void Emit(TQue<QuePosition::VECOUT, BUFFER_NUM> &queue, LocalTensor<float> &result,
+                                uint32_t count, uint32_t cmpCount)
+    {
+        LocalTensor<T> yLocal = queue.AllocTensor<T>();
+        if constexpr (IsSameType<T, float>::value) {
+            DataCopy(yLocal, result, cmpCount);
+        } else {
+            Cast(yLocal, result, RoundMode::CAST_RINT, count);
+        }
+        queue.EnQue(yLocal);
+    }
+
+    __aicore__ inline void CopyOut(TQue<QuePosition::VECOUT, BUFFER_NUM> &queue, GlobalTensor<T> &yGlobal,
+                                   uint32_t progress, uint32_t count)
+    {
+        LocalTensor<T> yLocal = queue.DeQue<T>();
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(count * sizeof(T)), 0, 0, 0};
+        DataCopyPad(yGlobal[progress * tileLength], yLocal, copyParams);
+        queue.FreeTensor(yLocal);
     }
 
 private:
-    AscendC::GlobalTensor<T> srcGlobal;          // 输入数据
-    AscendC::GlobalTensor<T> dstValuesGlobal;    // 输出最大值
-    AscendC::GlobalTensor<int32_t> dstIndiceGlobal; // 输出最大值对应的索引
+    TPipe pipe;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueue;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> sinhQueue;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> coshQueue;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> tanhQueue;
+    TBuf<QuePosition::VECCALC> calcBuf;
+    TBuf<QuePosition::VECCALC> maskBuf;
 
-    uint32_t total_length;  // 数据总长度
+    GlobalTensor<T> xGlobal;
+    GlobalTensor<T> sinhGlobal;
+    GlobalTensor<T> coshGlobal;
+    GlobalTensor<T> tanhGlobal;
+
+    uint32_t tileLength;
+    uint32_t tileAlign;
+    uint32_t length;
 };
 
-extern "C" __global__ __aicore__ void arg_max_with_value_plugin(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling) {
-    GET_TILING_DATA(tiling_data, tiling);
-    KernelArgMaxWithValue<half> op;
-    //补充init和process函数调用内容
-    op.Init(x, y, tiling_data.total_len);
+template <uint32_t MODE>
+__aicore__ inline void RunHyperbolic(GM_ADDR x, GM_ADDR y, GM_ADDR coshY, GM_ADDR tanhY,
+                                     const SinhCustomTilingData &tilingData)
+{
+    KernelHyperbolic<DTYPE_X, MODE> op;
+    op.Init(x, y, coshY, tanhY, tilingData);
     op.Process();
+}
 
+// tiling key 即 mode，未选中的输出不分配缓冲也不搬出
+extern "C" __global__ __aicore__ void sinh_custom(GM_ADDR x, GM_ADDR y, GM_ADDR cosh_y, GM_ADDR tanh_y,
+                                                  GM_ADDR workspace, GM_ADDR tiling) {
+    GET_TILING_DATA(tiling_data, tiling);
+    if (TILING_KEY_IS(1)) {
+        RunHyperbolic<1>(x, y, cosh_y, tanh_y, tiling_data);
+    } else if (TILING_KEY_IS(2)) {
+        RunHyperbolic<2>(x, y, cosh_y, tanh_y, tiling_data);
+    } else if (TILING_KEY_IS(3)) {
+        RunHyperbolic<3>(x, y, cosh_y, tanh_y, tiling_data);
+    } else if (TILING_KEY_IS(4)) {
+        RunHyperbolic<4>(x, y, cosh_y, tanh_y, tiling_data);
+    } else if (TILING_KEY_IS(5)) {
+        RunHyperbolic<5>(x, y, cosh_y, tanh_y, tiling_data);
+    } else if (TILING_KEY_IS(6)) {
+        RunHyperbolic<6>(x, y, cosh_y, tanh_y, tiling_data);
+    } else if (TILING_KEY_IS(7)) {
+        RunHyperbolic<7>(x, y, cosh_y, tanh_y, tiling_data);
+    }
 }
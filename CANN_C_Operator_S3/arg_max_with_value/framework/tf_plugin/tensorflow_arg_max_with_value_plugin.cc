@@ -21,3 +21,27 @@ REGISTER_CUSTOM_OP("ArgMaxWithValue")
     .OriginOpType("ArgMaxWithValue")      // name in tf module
     .ParseParamsByOperatorFn(AutoMappingByOpFn);
 }  // namespace domi
+
+namespace domi {
+// register op info to GE
+REGISTER_CUSTOM_OP("ArgMinWithValue")
+    .FrameworkType(TENSORFLOW)   // type: CAFFE, TENSORFLOW
+    .OriginOpType("ArgMinWithValue")      // name in tf module
+    .ParseParamsByOperatorFn(AutoMappingByOpFn);
+}  // namespace domi
+
+namespace domi {
+// register op info to GE
+REGISTER_CUSTOM_OP("TopKWithValue")
+    .FrameworkType(TENSORFLOW)   // type: CAFFE, TENSORFLOW
+    .OriginOpType("TopKWithValue")      // name in tf module
+    .ParseParamsByOperatorFn(AutoMappingByOpFn);
+}  // namespace domi
+
+namespace domi {
+// register op info to GE
+REGISTER_CUSTOM_OP("SegmentArgMaxWithValue")
+    .FrameworkType(TENSORFLOW)   // type: CAFFE, TENSORFLOW
+    .OriginOpType("SegmentArgMaxWithValue")      // name in tf module
+    .ParseParamsByOperatorFn(AutoMappingByOpFn);
+}  // namespace domi
@@ -1,10 +1,6 @@
 
-#include "register/tilingdata_base.h"
+#include "reduce_with_index_tiling.h"
 
 namespace optiling {
-BEGIN_TILING_DATA_DEF(ArgMaxWithValueTilingData)
-  TILING_DATA_FIELD_DEF(uint32_t, size);
-END_TILING_DATA_DEF;
-
-REGISTER_TILING_DATA_CLASS(ArgMaxWithValue, ArgMaxWithValueTilingData)
+REGISTER_TILING_DATA_CLASS(ArgMaxWithValue, ReduceWithIndexTilingData)
 }
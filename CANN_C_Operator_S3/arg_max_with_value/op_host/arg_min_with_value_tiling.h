@@ -0,0 +1,6 @@
+
+#include "reduce_with_index_tiling.h"
+
+namespace optiling {
+REGISTER_TILING_DATA_CLASS(ArgMinWithValue, ReduceWithIndexTilingData)
+}
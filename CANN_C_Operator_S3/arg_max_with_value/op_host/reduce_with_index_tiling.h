@@ -0,0 +1,580 @@
+#ifndef REDUCE_WITH_INDEX_TILING_H
+#define REDUCE_WITH_INDEX_TILING_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "register/tilingdata_base.h"
+#include "register/op_def_registry.h"
+#include "tiling/platform/platform_ascendc.h"
+
+// ArgMaxWithValue、ArgMinWithValue 共用的 tiling 数据、切分与形状推导，TopKWithValue 复用其切分
+namespace optiling {
+BEGIN_TILING_DATA_DEF(ReduceWithIndexTilingData)
+  // x 按归约维度视为 [outer, axis, inner]，输出为 [outer, inner]
+  TILING_DATA_FIELD_DEF(uint32_t, outer);
+  TILING_DATA_FIELD_DEF(uint32_t, axis);
+  TILING_DATA_FIELD_DEF(uint32_t, inner);
+  // 每组同时归约的 lane 数：ROW 为 inner 方向的元素，GATHER 为行，SPLIT 为每行切段的宽度
+  TILING_DATA_FIELD_DEF(uint32_t, lane_length);
+  // 每次搬入 UB 的归约方向长度：ROW 为行数，GATHER 为每行的元素数(32B 对齐)，SPLIT 为段数
+  TILING_DATA_FIELD_DEF(uint32_t, axis_tile);
+  TILING_DATA_FIELD_DEF(uint32_t, group_num);
+  // 每核处理的组数，最后一个核处理剩余部分
+  TILING_DATA_FIELD_DEF(uint32_t, block_groups);
+  TILING_DATA_FIELD_DEF(uint32_t, used_core_num);
+  // x 在 GM 中相邻 outer、相邻 axis 的元素间隔，连续时为 axis * inner 与 inner；inner 方向总是连续
+  TILING_DATA_FIELD_DEF(uint64_t, outer_stride);
+  TILING_DATA_FIELD_DEF(uint64_t, axis_stride);
+  // outer、axis 可由不相接的两段维度组成，记为 [high, low]：下标 k 的偏移为
+  // k / low * high_stride + k % low * stride；只有一段时 low 即其长度
+  TILING_DATA_FIELD_DEF(uint32_t, outer_low);
+  TILING_DATA_FIELD_DEF(uint32_t, axis_low);
+  TILING_DATA_FIELD_DEF(uint64_t, outer_high_stride);
+  TILING_DATA_FIELD_DEF(uint64_t, axis_high_stride);
+END_TILING_DATA_DEF;
+
+// 布局，与核函数一致：tiling key = 布局 + TILING_KEY_LAST_INDEX(相等时取最后一个索引) + 省略的输出
+// inner > 1：lane 沿 inner 方向，逐行搬入
+constexpr uint64_t LAYOUT_ROW = 1;
+// inner == 1：lane 为各行，逐列 gather
+constexpr uint64_t LAYOUT_GATHER = 2;
+// inner == 1 且行数不足以铺满各核的 lane、归约轴长：每行按 lane 宽度切段，各 lane 结果再标量合并
+constexpr uint64_t LAYOUT_SPLIT = 3;
+constexpr uint64_t TILING_KEY_LAST_INDEX = 10;
+// indices 与 values 都是可选输出，未连接的输出在核内不分配缓冲也不写回
+constexpr uint64_t TILING_KEY_INDICES_ONLY = 100;
+constexpr uint64_t TILING_KEY_VALUES_ONLY = 200;
+// indices 为 int64 时 tiling key 加 1000
+constexpr uint64_t TILING_KEY_INDEX_INT64 = 1000;
+constexpr size_t INDICES_INDEX = 0;
+constexpr size_t VALUES_INDEX = 1;
+// 属性 x_strides、axes、output_type 的下标
+constexpr size_t STRIDES_ATTR_INDEX = 3;
+constexpr size_t AXES_ATTR_INDEX = 4;
+constexpr size_t OUTPUT_TYPE_ATTR_INDEX = 5;
+constexpr int64_t UNKNOWN_RANK_DIM = -2;
+
+constexpr uint32_t BUFFER_NUM = 2;
+constexpr uint32_t BLOCK_SIZE = 32;
+// 每组 lane 数按 128 对齐，half 与 float 的 Compare 都是整数个 256B
+constexpr uint32_t LANE_ALIGN = 128;
+constexpr uint32_t MAX_LANE_LENGTH = 2048;
+// 归约轴达到该长度才按行切段，切段宽度不超过轴长的 1/8，标量合并的开销相对搬运可以忽略
+constexpr uint32_t SPLIT_MIN_AXIS = 4096;
+constexpr uint32_t SPLIT_MERGE_RATIO = 8;
+constexpr uint32_t SPLIT_MAX_LANE = 1024;
+// 索引在核内以 float 维护，归约轴长度不超过 2^24 时精确；
+// SPLIT 写 int64 索引时 lane 内只记段号，段数不超过 2^24 即可
+constexpr uint32_t MAX_AXIS = 1U << 24;
+// DataCopyPad 一次最多搬运的块数
+constexpr uint32_t MAX_BLOCK_COUNT = 4095;
+constexpr uint64_t RESERVED_UB = 8 * 1024;
+
+struct ReduceWithIndexShape {
+    uint32_t outer;
+    uint32_t axis;
+    uint32_t inner;
+    uint64_t outer_stride;
+    uint64_t axis_stride;
+    uint32_t outer_low;
+    uint32_t axis_low;
+    uint64_t outer_high_stride;
+    uint64_t axis_high_stride;
+};
+
+inline uint32_t CeilDiv(uint32_t value, uint32_t factor)
+{
+    return static_cast<uint32_t>((static_cast<uint64_t>(value) + factor - 1) / factor);
+}
+
+inline uint32_t AlignUp(uint32_t value, uint32_t factor)
+{
+    return CeilDiv(value, factor) * factor;
+}
+
+// dimension 支持负数，按维数回绕
+inline bool NormalizeDimension(int64_t dim_num, int64_t &dimension)
+{
+    if (dimension < 0) {
+        dimension += dim_num;
+    }
+    return dimension >= 0 && dimension < dim_num;
+}
+
+// 要求 x 不超过 UINT32_MAX 个元素且连续
+inline ge::graphStatus ParseReduceShape(const gert::Shape &shape, int64_t dimension, ReduceWithIndexShape &param)
+{
+    if (!NormalizeDimension(shape.GetDimNum(), dimension)) {
+        return ge::GRAPH_FAILED;
+    }
+    uint64_t outer = 1;
+    uint64_t inner = 1;
+    for (int64_t i = 0; i < static_cast<int64_t>(shape.GetDimNum()); i++) {
+        if (i < dimension) {
+            outer *= shape.GetDim(i);
+        } else if (i > dimension) {
+            inner *= shape.GetDim(i);
+        }
+    }
+    uint64_t axis = shape.GetDim(dimension);
+    if (axis == 0 || outer == 0 || inner == 0 || axis > MAX_AXIS || outer * axis * inner > UINT32_MAX) {
+        return ge::GRAPH_FAILED;
+    }
+    param.outer = static_cast<uint32_t>(outer);
+    param.axis = static_cast<uint32_t>(axis);
+    param.inner = static_cast<uint32_t>(inner);
+    param.outer_stride = axis * inner;
+    param.axis_stride = inner;
+    param.outer_low = param.outer;
+    param.axis_low = param.axis;
+    param.outer_high_stride = 0;
+    param.axis_high_stride = 0;
+    return ge::GRAPH_SUCCESS;
+}
+
+// 属性 output_type 为 ge::DataType 的取值，同 TF ArgMax 的 output_type，只支持 int32 与 int64；未设置时为 int32
+inline bool GetIndexType(const gert::RuntimeAttrs *attrs, ge::DataType &index_type)
+{
+    const int64_t *output_type = attrs->GetAttrPointer<int64_t>(OUTPUT_TYPE_ATTR_INDEX);
+    index_type = output_type == nullptr ? ge::DT_INT32 : static_cast<ge::DataType>(*output_type);
+    return index_type == ge::DT_INT32 || index_type == ge::DT_INT64;
+}
+
+// 归约的各维：属性 axes 非空时为其中各维(支持负数，不可重复)，否则为 dimension
+inline bool GetReduceAxes(const gert::RuntimeAttrs *attrs, int64_t dim_num, std::vector<bool> &reduced)
+{
+    reduced.assign(dim_num, false);
+    const gert::ContinuousVector *axes = attrs->GetAttrPointer<gert::ContinuousVector>(AXES_ATTR_INDEX);
+    if (axes == nullptr || axes->GetSize() == 0) {
+        int64_t dimension = *attrs->GetAttrPointer<int64_t>(0);
+        if (!NormalizeDimension(dim_num, dimension)) {
+            return false;
+        }
+        reduced[dimension] = true;
+        return true;
+    }
+    const int64_t *data = static_cast<const int64_t *>(axes->GetData());
+    for (size_t i = 0; i < axes->GetSize(); i++) {
+        int64_t axis = data[i];
+        if (!NormalizeDimension(dim_num, axis) || reduced[axis]) {
+            return false;
+        }
+        reduced[axis] = true;
+    }
+    return true;
+}
+
+// 合并后的一段维度：长度与相邻元素在 GM 中的间隔(以元素计)
+struct StridedDim {
+    uint64_t size;
+    uint64_t stride;
+};
+
+// 按维度顺序追加一维，与上一段首尾相接时合并；长度为 1 的维跳过
+inline void AppendStridedDim(std::vector<StridedDim> &dims, uint64_t size, uint64_t stride)
+{
+    if (size == 1) {
+        return;
+    }
+    if (!dims.empty() && dims.back().stride == size * stride) {
+        dims.back().size *= size;
+        dims.back().stride = stride;
+        return;
+    }
+    dims.push_back({size, stride});
+}
+
+// 1 至 2 段维度记为 [high, low]：下标 k 的偏移为 k / low * high_stride + k % low * stride；没有时长度为 1
+inline void SetSplitDims(const std::vector<StridedDim> &dims, uint32_t &size, uint32_t &low, uint64_t &stride,
+                         uint64_t &high_stride)
+{
+    size = 1;
+    low = 1;
+    stride = 0;
+    high_stride = 0;
+    if (!dims.empty()) {
+        size = static_cast<uint32_t>(dims.size() == 2 ? dims[0].size * dims[1].size : dims[0].size);
+        low = static_cast<uint32_t>(dims.back().size);
+        stride = dims.back().stride;
+        high_stride = dims.size() == 2 ? dims[0].stride : 0;
+    }
+}
+
+// 把 x 按保留维与归约维映射为 [outer, axis, inner]。strides 为 x 各维的 stride(以元素计)，为空时 x 连续，
+// 非空时 x 为转置、切片等视图，核内按 stride 直接搬运，无需先拷贝为连续。
+// 保留维、归约维各自按维度顺序合并首尾相接的维：输出按保留维的顺序排列，索引为归约维上按行优先展平的位置，
+// 合并不改变两者，相邻的归约维与转置后恰好相接的维都合并为一段。
+// 最后一段保留维连续时作为 inner，否则 inner 为 1、最后一段归约维须连续；其余保留维为 outer，与 axis 各至多两段。
+// 偏移在核内按 64 位计算，x 可超过 2^32 个元素；inner == 1 且 axis 只有一段时可超过 MAX_AXIS，由调用方确认索引能否表示
+inline ge::graphStatus MapReduceDims(const gert::Shape &shape, const std::vector<bool> &reduced,
+                                     const int64_t *strides, size_t stride_num, ReduceWithIndexShape &param)
+{
+    size_t dim_num = shape.GetDimNum();
+    if (stride_num != 0 && stride_num != dim_num) {
+        return ge::GRAPH_FAILED;
+    }
+    // 各维的 stride，连续时按形状推出
+    std::vector<uint64_t> dim_strides(dim_num);
+    uint64_t contiguous = 1;
+    for (size_t i = dim_num; i-- > 0;) {
+        int64_t size = shape.GetDim(i);
+        if (size <= 0 || (stride_num != 0 && size > 1 && strides[i] <= 0)) {
+            return ge::GRAPH_FAILED;
+        }
+        dim_strides[i] = stride_num != 0 ? static_cast<uint64_t>(strides[i]) : contiguous;
+        contiguous *= size;
+    }
+    std::vector<StridedDim> kept;
+    std::vector<StridedDim> axes;
+    for (size_t i = 0; i < dim_num; i++) {
+        AppendStridedDim(reduced[i] ? axes : kept, shape.GetDim(i), dim_strides[i]);
+    }
+    uint64_t inner = 1;
+    if (!kept.empty() && kept.back().stride == 1) {
+        inner = kept.back().size;
+        kept.pop_back();
+    } else if (!axes.empty() && axes.back().stride != 1) {
+        return ge::GRAPH_FAILED;
+    }
+    if (kept.size() > 2 || axes.size() > 2) {
+        return ge::GRAPH_FAILED;
+    }
+    uint64_t outer = kept.empty() ? 1 : (kept.size() == 2 ? kept[0].size * kept[1].size : kept[0].size);
+    uint64_t axis = axes.empty() ? 1 : (axes.size() == 2 ? axes[0].size * axes[1].size : axes[0].size);
+    uint64_t max_axis = inner == 1 && axes.size() < 2 ? UINT32_MAX : MAX_AXIS;
+    if (axis > max_axis || outer > UINT32_MAX || inner > UINT32_MAX / sizeof(int64_t)) {
+        return ge::GRAPH_FAILED;
+    }
+    SetSplitDims(kept, param.outer, param.outer_low, param.outer_stride, param.outer_high_stride);
+    SetSplitDims(axes, param.axis, param.axis_low, param.axis_stride, param.axis_high_stride);
+    param.inner = static_cast<uint32_t>(inner);
+    if (axes.empty()) {
+        param.axis_stride = inner;
+    }
+    if (kept.empty()) {
+        param.outer_stride = param.axis_low;
+    }
+    // 逐行搬运时各行不重叠，行间的间隔(字节)可用 32 位表示
+    uint64_t row_stride = inner > 1 ? param.axis_stride : param.outer_stride;
+    uint64_t row_length = inner > 1 ? inner : param.axis_low;
+    if (row_stride < row_length || (row_stride - row_length) * sizeof(int64_t) > UINT32_MAX) {
+        return ge::GRAPH_FAILED;
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+// x 以 FRACTAL_NZ 存放(如 matmul 的输出)时，逻辑形状 [..., M, N] 存为 [..., N1, M1, M0, C0] 的分形，
+// 元素 (m, n) 位于 n / C0 * (M1 * M0 * C0) + m * C0 + n % C0。把 N 拆为 [N1, C0] 两维并给出各维 stride 后
+// 按视图映射，核内沿归约轴逐个分形列块搬运，输出仍为 ND，无需前置 TransData。
+// N 不是 C0 的倍数时最后一个列块含填充，只支持仅沿最后一维归约，归约轴取 N，不读入填充的列
+inline ge::graphStatus MapFractalNzDims(const gert::Shape &shape, const gert::Shape &storage,
+                                        const std::vector<bool> &reduced, ReduceWithIndexShape &param)
+{
+    size_t dim_num = shape.GetDimNum();
+    if (dim_num < 2 || dim_num + 1 > gert::Shape::kMaxDimNum || storage.GetDimNum() != dim_num + 2) {
+        return ge::GRAPH_FAILED;
+    }
+    int64_t m = shape.GetDim(dim_num - 2);
+    int64_t n = shape.GetDim(dim_num - 1);
+    int64_t n1 = storage.GetDim(dim_num - 2);
+    int64_t m1 = storage.GetDim(dim_num - 1);
+    int64_t m0 = storage.GetDim(dim_num);
+    int64_t c0 = storage.GetDim(dim_num + 1);
+    if (m <= 0 || n <= 0 || m0 <= 0 || c0 <= 0 || n1 != (n + c0 - 1) / c0 || m1 != (m + m0 - 1) / m0) {
+        return ge::GRAPH_FAILED;
+    }
+    bool padded = n % c0 != 0;
+    for (size_t i = 0; i + 2 < dim_num; i++) {
+        if (storage.GetDim(i) != shape.GetDim(i)) {
+            return ge::GRAPH_FAILED;
+        }
+    }
+    for (size_t i = 0; padded && i + 1 < dim_num; i++) {
+        if (reduced[i]) {
+            return ge::GRAPH_FAILED;
+        }
+    }
+    // 展开为 [..., M, N1, C0]，batch 各维按分形整块连续排列
+    gert::Shape view;
+    std::vector<bool> view_reduced(reduced.begin(), reduced.end());
+    view_reduced.push_back(reduced[dim_num - 1]);
+    std::vector<int64_t> strides(dim_num + 1);
+    int64_t contiguous = n1 * m1 * m0 * c0;
+    for (size_t i = dim_num - 2; i-- > 0;) {
+        strides[i] = contiguous;
+        contiguous *= shape.GetDim(i);
+    }
+    for (size_t i = 0; i + 2 < dim_num; i++) {
+        view.AppendDim(shape.GetDim(i));
+    }
+    view.AppendDim(m);
+    view.AppendDim(n1);
+    view.AppendDim(c0);
+    strides[dim_num - 2] = c0;
+    strides[dim_num - 1] = m1 * m0 * c0;
+    strides[dim_num] = 1;
+    if (MapReduceDims(view, view_reduced, strides.data(), strides.size(), param) != ge::GRAPH_SUCCESS) {
+        return ge::GRAPH_FAILED;
+    }
+    if (padded) {
+        param.axis = static_cast<uint32_t>(n);
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+inline uint32_t InputTypeSize(gert::TilingContext *context)
+{
+    ge::DataType dtype = context->GetInputDesc(0)->GetDataType();
+    return dtype == ge::DT_UINT8 ? 1 : (dtype == ge::DT_FLOAT16 || dtype == ge::DT_BF16 ? 2 : 4);
+}
+
+// 核内比较所用类型的字节数，与核函数的 ComputeType 一致：uint8 转为 half，bf16 转为 float
+inline uint32_t ComputeTypeSize(gert::TilingContext *context)
+{
+    ge::DataType dtype = context->GetInputDesc(0)->GetDataType();
+    return dtype == ge::DT_UINT8 || dtype == ge::DT_FLOAT16 ? 2 : 4;
+}
+
+// 选择布局并确定每组 lane 数与每次搬入的归约方向长度，写入 tiling 的公共字段并设置核数，返回布局；
+// lane_bytes 为调用方每个 lane 常驻 UB 的字节数，各布局自身所需的缓冲在此另行计入；UB 不足时返回 0
+template <typename TilingData>
+inline uint64_t SplitReduceLanes(gert::TilingContext *context, const ReduceWithIndexShape &shape, uint32_t lane_bytes,
+                                 TilingData &tiling)
+{
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    uint32_t core_num = ascendcPlatform.GetCoreNumAiv();
+    uint64_t ub_size;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ub_size);
+    ub_size -= RESERVED_UB;
+
+    uint32_t type_size = InputTypeSize(context);
+    // uint8 与 bf16 转为更宽的类型比较，每行候选需一份副本
+    uint32_t compute_size = ComputeTypeSize(context);
+    uint32_t cast_bytes = type_size != compute_size ? compute_size : 0;
+
+    uint64_t layout;
+    uint32_t lane_length;
+    // 每个 lane 每个归约单位(ROW 为一行、GATHER 为一列、SPLIT 为一段)所需的字节数、单位个数的对齐与上限
+    uint32_t unit_bytes = BUFFER_NUM * type_size;
+    uint32_t unit_align = 1;
+    uint32_t max_units;
+    if (shape.inner > 1) {
+        layout = LAYOUT_ROW;
+        lane_length = std::min(AlignUp(shape.inner, LANE_ALIGN), MAX_LANE_LENGTH);
+        // outer 少于核数时缩短 lane，让各核都分到组
+        lane_length = std::min(lane_length, AlignUp(CeilDiv(shape.inner, CeilDiv(core_num, shape.outer)), LANE_ALIGN));
+        lane_bytes += cast_bytes;
+        max_units = std::min(shape.axis, MAX_BLOCK_COUNT);
+    } else if (shape.axis_low == shape.axis &&
+               ((shape.axis >= SPLIT_MIN_AXIS && shape.outer < core_num * LANE_ALIGN) || shape.axis > MAX_AXIS)) {
+        layout = LAYOUT_SPLIT;
+        lane_length = shape.axis / SPLIT_MERGE_RATIO / LANE_ALIGN * LANE_ALIGN;
+        lane_length = std::min(std::max(lane_length, LANE_ALIGN), SPLIT_MAX_LANE);
+        // lane 内位置、候选索引、合并用的 float 副本与待写回的结果
+        lane_bytes += cast_bytes + 4 * sizeof(float) + compute_size;
+        max_units = CeilDiv(shape.axis, lane_length);
+    } else {
+        layout = LAYOUT_GATHER;
+        // 行数多时让各核都分到组；outer 分两段时每组的行不跨段
+        lane_length = std::min(AlignUp(CeilDiv(shape.outer, core_num), LANE_ALIGN), MAX_LANE_LENGTH);
+        lane_length = std::min(lane_length, AlignUp(shape.outer_low, LANE_ALIGN));
+        // gather 出的一列、行首偏移与 gather 偏移
+        lane_bytes += compute_size + 2 * sizeof(int32_t);
+        unit_bytes += cast_bytes;
+        unit_align = BLOCK_SIZE / type_size;
+        // axis 分两段时每次只搬一段内连续的部分
+        max_units = AlignUp(shape.axis_low, unit_align);
+    }
+    uint32_t axis_tile = 0;
+    while (lane_length >= LANE_ALIGN) {
+        uint64_t lanes_bytes = static_cast<uint64_t>(lane_length) * lane_bytes;
+        if (ub_size > lanes_bytes) {
+            axis_tile = (ub_size - lanes_bytes) / lane_length / unit_bytes / unit_align * unit_align;
+        }
+        if (axis_tile >= unit_align) {
+            break;
+        }
+        lane_length -= LANE_ALIGN;
+    }
+    if (lane_length < LANE_ALIGN || (layout == LAYOUT_SPLIT && CeilDiv(shape.axis, lane_length) > MAX_AXIS)) {
+        return 0;
+    }
+    axis_tile = std::min(axis_tile, max_units);
+    uint64_t groups;
+    if (layout == LAYOUT_ROW) {
+        groups = static_cast<uint64_t>(shape.outer) * CeilDiv(shape.inner, lane_length);
+    } else if (layout == LAYOUT_SPLIT) {
+        groups = shape.outer;
+    } else {
+        groups = static_cast<uint64_t>(shape.outer / shape.outer_low) * CeilDiv(shape.outer_low, lane_length);
+    }
+    if (groups > UINT32_MAX) {
+        return 0;
+    }
+    uint32_t group_num = static_cast<uint32_t>(groups);
+    uint32_t block_groups = CeilDiv(group_num, core_num);
+    uint32_t used_core_num = CeilDiv(group_num, block_groups);
+
+    tiling.set_outer(shape.outer);
+    tiling.set_axis(shape.axis);
+    tiling.set_inner(shape.inner);
+    tiling.set_lane_length(lane_length);
+    tiling.set_axis_tile(axis_tile);
+    tiling.set_group_num(group_num);
+    tiling.set_block_groups(block_groups);
+    tiling.set_used_core_num(used_core_num);
+    context->SetBlockDim(used_core_num);
+    return layout;
+}
+
+// 属性依次为 dimension、keep_dims、select_last_index、x_strides、axes、output_type
+inline ge::graphStatus TilingReduceWithIndex(gert::TilingContext *context)
+{
+    ReduceWithIndexTilingData tiling;
+    ReduceWithIndexShape shape;
+    const gert::RuntimeAttrs *attrs = context->GetAttrs();
+    const bool *select_last_index = attrs->GetAttrPointer<bool>(2);
+    bool has_indices = context->GetOutputShape(INDICES_INDEX) != nullptr;
+    bool has_values = context->GetOutputShape(VALUES_INDEX) != nullptr;
+    if (!has_indices && !has_values) {
+        return ge::GRAPH_FAILED;
+    }
+    // 核内偏移按 64 位计算，x 可超过 2^32 个元素；int32 索引仍要求归约轴不超过 MAX_AXIS。
+    // 索引类型由 output_type 决定，连接的 indices 须与之一致
+    ge::DataType index_type;
+    if (!GetIndexType(attrs, index_type)) {
+        return ge::GRAPH_FAILED;
+    }
+    if (has_indices && context->GetOutputDesc(INDICES_INDEX)->GetDataType() != index_type) {
+        return ge::GRAPH_FAILED;
+    }
+    bool index_int64 = has_indices && index_type == ge::DT_INT64;
+    // FRACTAL_NZ 的归约维按原始(ND)形状给出
+    const gert::StorageShape *x_storage = context->GetInputShape(0);
+    bool x_nz = ge::GetPrimaryFormat(context->GetInputDesc(0)->GetStorageFormat()) == ge::FORMAT_FRACTAL_NZ;
+    const gert::Shape &x_shape = x_nz ? x_storage->GetOriginShape() : x_storage->GetStorageShape();
+    std::vector<bool> reduced;
+    if (!GetReduceAxes(attrs, x_shape.GetDimNum(), reduced)) {
+        return ge::GRAPH_FAILED;
+    }
+    // x_strides 为空时 x 连续，FRACTAL_NZ 不支持再给出 stride
+    const gert::ContinuousVector *strides = attrs->GetAttrPointer<gert::ContinuousVector>(STRIDES_ATTR_INDEX);
+    const int64_t *stride_data = strides != nullptr ? static_cast<const int64_t *>(strides->GetData()) : nullptr;
+    size_t stride_num = strides != nullptr ? strides->GetSize() : 0;
+    ge::graphStatus status;
+    if (x_nz) {
+        status = stride_num == 0 ? MapFractalNzDims(x_shape, x_storage->GetStorageShape(), reduced, shape)
+                                 : ge::GRAPH_FAILED;
+    } else {
+        status = MapReduceDims(x_shape, reduced, stride_data, stride_num, shape);
+    }
+    if (status != ge::GRAPH_SUCCESS) {
+        return ge::GRAPH_FAILED;
+    }
+    if (has_indices && !index_int64 && shape.axis > MAX_AXIS) {
+        return ge::GRAPH_FAILED;
+    }
+    uint32_t index_size = index_int64 ? sizeof(int64_t) : sizeof(int32_t);
+
+    uint32_t type_size = InputTypeSize(context);
+    uint32_t compute_size = ComputeTypeSize(context);
+    // 每个 lane 常驻 UB 的字节数：最优值、float 索引、掩码、写出的输出各双缓冲，int32 还需差值与其 float 副本；
+    // int64 索引在 SPLIT 中暂存的结果多占 4 字节，其余布局也按此预留
+    uint32_t lane_bytes = compute_size + sizeof(float) + 1;
+    lane_bytes += BUFFER_NUM * ((has_indices ? index_size : 0) + (has_values ? type_size : 0));
+    if (index_int64) {
+        lane_bytes += sizeof(int64_t) - sizeof(float);
+    }
+    if (context->GetInputDesc(0)->GetDataType() == ge::DT_INT32) {
+        lane_bytes += sizeof(int32_t) + sizeof(float);
+    }
+    uint64_t layout = SplitReduceLanes(context, shape, lane_bytes, tiling);
+    if (layout == 0) {
+        return ge::GRAPH_FAILED;
+    }
+
+    uint64_t tiling_key = layout + (*select_last_index ? TILING_KEY_LAST_INDEX : 0);
+    if (!has_values) {
+        tiling_key += TILING_KEY_INDICES_ONLY;
+    } else if (!has_indices) {
+        tiling_key += TILING_KEY_VALUES_ONLY;
+    }
+    if (index_int64) {
+        tiling_key += TILING_KEY_INDEX_INT64;
+    }
+    tiling.set_outer_stride(shape.outer_stride);
+    tiling.set_axis_stride(shape.axis_stride);
+    tiling.set_outer_low(shape.outer_low);
+    tiling.set_axis_low(shape.axis_low);
+    tiling.set_outer_high_stride(shape.outer_high_stride);
+    tiling.set_axis_high_stride(shape.axis_high_stride);
+    context->SetTilingKey(tiling_key);
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+    size_t *currentWorkspace = context->GetWorkspaceSizes(1);
+    currentWorkspace[0] = 0;
+    return ge::GRAPH_SUCCESS;
+}
+
+// 动态 rank 的形状记为只有一维 -2
+inline bool IsUnknownRank(const gert::Shape &shape)
+{
+    return shape.GetDimNum() == 1 && shape.GetDim(0) == UNKNOWN_RANK_DIM;
+}
+
+// indices 与 values 形状相同：去掉各归约维，keep_dims 时保留为 1；未连接的可选输出跳过。
+// 动态维(-1)按原样传递，x 为动态 rank 时输出也是动态 rank
+inline ge::graphStatus InferReduceWithIndexShape(gert::InferShapeContext *context)
+{
+    const gert::Shape *x_shape = context->GetInputShape(0);
+    const gert::RuntimeAttrs *attrs = context->GetAttrs();
+    const bool *keep_dims = attrs->GetAttrPointer<bool>(1);
+    int64_t dim_num = x_shape->GetDimNum();
+    bool unknown_rank = IsUnknownRank(*x_shape);
+    std::vector<bool> reduced;
+    if (!unknown_rank && !GetReduceAxes(attrs, dim_num, reduced)) {
+        return ge::GRAPH_FAILED;
+    }
+    for (size_t i = 0; i < 2; i++) {
+        gert::Shape *y_shape = context->GetOutputShape(i);
+        if (y_shape == nullptr) {
+            continue;
+        }
+        if (unknown_rank) {
+            *y_shape = *x_shape;
+            continue;
+        }
+        y_shape->SetDimNum(0);
+        for (int64_t d = 0; d < dim_num; d++) {
+            if (!reduced[d]) {
+                y_shape->AppendDim(x_shape->GetDim(d));
+            } else if (*keep_dims) {
+                y_shape->AppendDim(1);
+            }
+        }
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+// indices 为 index_type，values 与 x 同类型
+inline ge::graphStatus InferReduceWithIndexDataType(gert::InferDataTypeContext *context,
+                                                    ge::DataType index_type = ge::DT_INT32)
+{
+    context->SetOutputDataType(INDICES_INDEX, index_type);
+    context->SetOutputDataType(VALUES_INDEX, context->GetInputDataType(0));
+    return ge::GRAPH_SUCCESS;
+}
+
+// ArgMax/ArgMin 的 indices 类型由属性 output_type 给出，图模式下据此推导出 int64 索引
+inline ge::graphStatus InferArgReduceDataType(gert::InferDataTypeContext *context)
+{
+    ge::DataType index_type;
+    if (!GetIndexType(context->GetAttrs(), index_type)) {
+        return ge::GRAPH_FAILED;
+    }
+    return InferReduceWithIndexDataType(context, index_type);
+}
+}
+
+#endif // REDUCE_WITH_INDEX_TILING_H
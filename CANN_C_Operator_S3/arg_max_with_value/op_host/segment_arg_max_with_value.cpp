@@ -0,0 +1,133 @@
+
+#include "segment_arg_max_with_value_tiling.h"
+#include "register/op_def_registry.h"
+
+
+namespace optiling {
+// 每核至少分到的元素数，元素少时少用几个核，省去核间同步
+constexpr uint32_t SEGMENT_MIN_BLOCK = 8192;
+// 段内取最值用带索引的 ReduceMax，half 的索引按 16 位返回，一次规约不超过该长度
+constexpr uint32_t SEGMENT_MAX_TILE = 16384;
+// 与核函数一致：各段结果攒够该数目后写回一次；workspace 中每核一个 32B 的槽位
+constexpr uint32_t SEGMENT_STAGE_LENGTH = 1024;
+constexpr uint32_t SEGMENT_SLOT_SIZE = 32;
+constexpr size_t OFFSETS_INDEX = 1;
+
+static ge::graphStatus TilingFunc(gert::TilingContext* context)
+{
+    SegmentArgMaxWithValueTilingData tiling;
+    const gert::Shape &x_shape = context->GetInputShape(0)->GetStorageShape();
+    const gert::Shape &offsets_shape = context->GetInputShape(OFFSETS_INDEX)->GetStorageShape();
+    if (x_shape.GetDimNum() != 1 || offsets_shape.GetDimNum() != 1 || offsets_shape.GetDim(0) < 1) {
+        return ge::GRAPH_FAILED;
+    }
+    // 位置与索引均为 int32
+    int64_t total_length = x_shape.GetDim(0);
+    int64_t segment_num = offsets_shape.GetDim(0) - 1;
+    if (total_length < 0 || total_length > INT32_MAX || segment_num > INT32_MAX) {
+        return ge::GRAPH_FAILED;
+    }
+
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    uint32_t core_num = ascendcPlatform.GetCoreNumAiv();
+    uint64_t ub_size;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ub_size);
+    uint32_t type_size = InputTypeSize(context);
+    // 按元素数而非段数均分，段长差异再大各核的搬运量也相同
+    uint32_t length = static_cast<uint32_t>(total_length);
+    uint32_t block_length = std::max(AlignUp(CeilDiv(length, core_num), BLOCK_SIZE), SEGMENT_MIN_BLOCK);
+    uint32_t used_core_num = std::max(CeilDiv(length, block_length), 1U);
+
+    // 双缓冲的输入、ReduceMax 的工作区；另有暂存的各段结果、规约结果与各核的槽位
+    uint64_t fixed_bytes = RESERVED_UB + SEGMENT_STAGE_LENGTH * (sizeof(int32_t) + type_size) + BLOCK_SIZE +
+                           AlignUp(used_core_num * SEGMENT_SLOT_SIZE, BLOCK_SIZE);
+    uint64_t element_bytes = (BUFFER_NUM + 1) * type_size;
+    if (ub_size <= fixed_bytes + BLOCK_SIZE * element_bytes) {
+        return ge::GRAPH_FAILED;
+    }
+    uint32_t tile_length = (ub_size - fixed_bytes) / element_bytes / BLOCK_SIZE * BLOCK_SIZE;
+    tile_length = std::min(std::min(tile_length, SEGMENT_MAX_TILE), block_length);
+
+    tiling.set_total_length(length);
+    tiling.set_segment_num(static_cast<uint32_t>(segment_num));
+    tiling.set_block_length(block_length);
+    tiling.set_tile_length(tile_length);
+    tiling.set_used_core_num(used_core_num);
+    context->SetBlockDim(used_core_num);
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+    size_t *currentWorkspace = context->GetWorkspaceSizes(1);
+    currentWorkspace[0] = ascendcPlatform.GetLibApiWorkSpaceSize() + used_core_num * SEGMENT_SLOT_SIZE;
+    return ge::GRAPH_SUCCESS;
+}
+}
+
+
+namespace ge {
+// indices 与 values 均为 [segment_num]，offsets 的长度未知时输出也未知
+static ge::graphStatus InferShape(gert::InferShapeContext* context)
+{
+    const gert::Shape *offsets_shape = context->GetInputShape(optiling::OFFSETS_INDEX);
+    int64_t segment_num = -1;
+    if (!optiling::IsUnknownRank(*offsets_shape)) {
+        if (offsets_shape->GetDimNum() != 1 || offsets_shape->GetDim(0) == 0) {
+            return GRAPH_FAILED;
+        }
+        segment_num = offsets_shape->GetDim(0) < 0 ? -1 : offsets_shape->GetDim(0) - 1;
+    }
+    for (size_t i = 0; i < 2; i++) {
+        gert::Shape *y_shape = context->GetOutputShape(i);
+        y_shape->SetDimNum(0);
+        y_shape->AppendDim(segment_num);
+    }
+    return GRAPH_SUCCESS;
+}
+
+static ge::graphStatus InferDataType(gert::InferDataTypeContext* context)
+{
+    context->SetOutputDataType(optiling::INDICES_INDEX, ge::DT_INT32);
+    context->SetOutputDataType(optiling::VALUES_INDEX, context->GetInputDataType(0));
+    return GRAPH_SUCCESS;
+}
+}
+
+
+namespace ops {
+class SegmentArgMaxWithValue : public OpDef {
+public:
+    explicit SegmentArgMaxWithValue(const char* name) : OpDef(name)
+    {
+        this->Input("x")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT, ge::DT_FLOAT16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND});
+        // 第 i 段为 x[offsets[i], offsets[i + 1])，要求 offsets[0] == 0、单调不减且最后一个为 x 的长度
+        this->Input("offsets")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_INT32, ge::DT_INT32})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND});
+        // 最大值在段内的位置，有多个时取第一个；空段为 -1，其 values 为 0
+        this->Output("indices")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_INT32, ge::DT_INT32})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Output("values")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT, ge::DT_FLOAT16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND});
+
+        this->SetInferShape(ge::InferShape).SetInferDataType(ge::InferDataType);
+
+        this->AICore()
+            .SetTiling(optiling::TilingFunc);
+        this->AICore().AddConfig("ascend910b");
+
+    }
+};
+
+OP_ADD(SegmentArgMaxWithValue);
+}
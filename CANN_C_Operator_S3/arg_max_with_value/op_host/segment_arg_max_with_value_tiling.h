@@ -0,0 +1,20 @@
+#ifndef SEGMENT_ARG_MAX_WITH_VALUE_TILING_H
+#define SEGMENT_ARG_MAX_WITH_VALUE_TILING_H
+
+#include "reduce_with_index_tiling.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(SegmentArgMaxWithValueTilingData)
+  // x 的元素数与段数，offsets 有 segment_num + 1 个元素
+  TILING_DATA_FIELD_DEF(uint32_t, total_length);
+  TILING_DATA_FIELD_DEF(uint32_t, segment_num);
+  // 按元素数均分到各核，与段的边界无关；跨核的段经 workspace 合并
+  TILING_DATA_FIELD_DEF(uint32_t, block_length);
+  TILING_DATA_FIELD_DEF(uint32_t, tile_length);
+  TILING_DATA_FIELD_DEF(uint32_t, used_core_num);
+END_TILING_DATA_DEF;
+
+REGISTER_TILING_DATA_CLASS(SegmentArgMaxWithValue, SegmentArgMaxWithValueTilingData)
+}
+
+#endif // SEGMENT_ARG_MAX_WITH_VALUE_TILING_H
@@ -0,0 +1,14 @@
+
+#include "tiling_cache.h"
+
+
+// 供性能分析读取的命中与未命中次数，只由 arg_max_with_value 工程导出
+extern "C" __attribute__((visibility("default"))) uint64_t OptilingTilingCacheHits()
+{
+    return optiling::GetTilingCacheCounters().hits.load(std::memory_order_relaxed);
+}
+
+extern "C" __attribute__((visibility("default"))) uint64_t OptilingTilingCacheMisses()
+{
+    return optiling::GetTilingCacheCounters().misses.load(std::memory_order_relaxed);
+}
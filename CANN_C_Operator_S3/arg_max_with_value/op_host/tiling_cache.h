@@ -0,0 +1,231 @@
+#ifndef TILING_CACHE_H
+#define TILING_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include "register/op_def_registry.h"
+#include "tiling/platform/platform_ascendc.h"
+
+// 动态 shape 下 TilingFunc 每次下发都会执行。按 (核资源、各输入的 dtype 与 shape、可选输出是否连接、属性)
+// 缓存序列化后的 tiling 结果，命中时直接写回 tiling 数据、tiling key、核数与 workspace。
+// 命中须比重新切分便宜：键为定长的 64 位字数组，不分配内存；每个算子每个线程一份缓存，不加锁；
+// 按键的哈希选组，组内按最近使用淘汰。只用于切分开销明显大于一次查找的算子
+namespace optiling {
+// 键超出该长度或 tiling 数据超出该大小时不缓存
+constexpr uint32_t TILING_CACHE_KEY_WORDS = 48;
+constexpr uint32_t TILING_CACHE_DATA_SIZE = 256;
+constexpr uint32_t TILING_CACHE_SETS = 8;
+constexpr uint32_t TILING_CACHE_WAYS = 4;
+// 属性缺省(可选属性未设置)时写入键的值
+constexpr uint64_t TILING_CACHE_ABSENT = 0xFFFFFFFFFFFFFFFFULL;
+
+struct TilingCacheKey {
+    uint64_t words[TILING_CACHE_KEY_WORDS];
+    uint32_t size;
+    uint64_t hash;
+
+    bool Append(uint64_t word)
+    {
+        if (size == TILING_CACHE_KEY_WORDS) {
+            return false;
+        }
+        words[size++] = word;
+        hash = (hash ^ word) * 0x100000001B3ULL;
+        return true;
+    }
+    bool Equals(const TilingCacheKey &other) const
+    {
+        return size == other.size && memcmp(words, other.words, size * sizeof(uint64_t)) == 0;
+    }
+};
+
+struct TilingCacheEntry {
+    TilingCacheKey key;
+    // 0 为空槽；generation 与缓存的不同时视为已清空
+    uint64_t last_use;
+    uint64_t generation;
+    uint64_t tiling_key;
+    size_t workspace_size;
+    uint32_t block_dim;
+    uint32_t data_size;
+    uint8_t data[TILING_CACHE_DATA_SIZE];
+};
+
+// 命中与未命中(即实际执行切分)的次数，各线程、各算子合计；generation 变化时各缓存在下次查找时清空
+struct TilingCacheCounters {
+    std::atomic<uint64_t> hits;
+    std::atomic<uint64_t> misses;
+    std::atomic<uint64_t> generation;
+};
+
+inline TilingCacheCounters &GetTilingCacheCounters()
+{
+    static TilingCacheCounters counters;
+    return counters;
+}
+
+// 清空所有缓存，供测试与基准测量冷启动
+inline void ClearTilingCache()
+{
+    GetTilingCacheCounters().generation.fetch_add(1, std::memory_order_relaxed);
+}
+
+// 全零即为空缓存，可直接定义为 static thread_local，无初始化开销
+struct TilingCache {
+    TilingCacheEntry entries[TILING_CACHE_SETS][TILING_CACHE_WAYS];
+    uint64_t clock;
+    uint64_t generation;
+
+    TilingCacheEntry *Find(const TilingCacheKey &key)
+    {
+        generation = GetTilingCacheCounters().generation.load(std::memory_order_relaxed);
+        TilingCacheEntry *set = entries[key.hash % TILING_CACHE_SETS];
+        for (uint32_t i = 0; i < TILING_CACHE_WAYS; i++) {
+            if (Valid(set[i]) && set[i].key.Equals(key)) {
+                set[i].last_use = ++clock;
+                return &set[i];
+            }
+        }
+        return nullptr;
+    }
+
+    bool Valid(const TilingCacheEntry &entry) const
+    {
+        return entry.last_use != 0 && entry.generation == generation;
+    }
+
+    // 记录 context 中已算好的结果，优先占用空槽，否则替换组内最久未用的一项；须在 Find 之后调用
+    void Store(const TilingCacheKey &key, gert::TilingContext *context)
+    {
+        gert::TilingData *raw = context->GetRawTilingData();
+        if (raw->GetDataSize() > TILING_CACHE_DATA_SIZE) {
+            return;
+        }
+        TilingCacheEntry *set = entries[key.hash % TILING_CACHE_SETS];
+        TilingCacheEntry *victim = &set[0];
+        for (uint32_t i = 0; i < TILING_CACHE_WAYS && Valid(*victim); i++) {
+            if (!Valid(set[i]) || set[i].last_use < victim->last_use) {
+                victim = &set[i];
+            }
+        }
+        victim->key.size = key.size;
+        memcpy(victim->key.words, key.words, key.size * sizeof(uint64_t));
+        victim->last_use = ++clock;
+        victim->generation = generation;
+        victim->tiling_key = context->GetTilingKey();
+        victim->workspace_size = context->GetWorkspaceSizes(1)[0];
+        victim->block_dim = context->GetBlockDim();
+        victim->data_size = static_cast<uint32_t>(raw->GetDataSize());
+        memcpy(victim->data, raw->GetData(), victim->data_size);
+    }
+};
+
+// attr_types 按属性顺序给出类型：i 为 int，b 为 bool，f 为 float，l 为 list_int
+inline bool MakeTilingCacheKey(gert::TilingContext *context, const char *attr_types, TilingCacheKey &key)
+{
+    key.size = 0;
+    key.hash = 0xCBF29CE484222325ULL;
+    // 切分只依赖核数与 UB 大小
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    uint64_t ub_size;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ub_size);
+    key.Append(ascendcPlatform.GetCoreNumAiv());
+    key.Append(ub_size);
+    for (size_t i = 0; i < context->GetComputeNodeInputNum(); i++) {
+        const gert::StorageShape *shape = context->GetInputShape(i);
+        const gert::CompileTimeTensorDesc *desc = context->GetInputDesc(i);
+        if (shape == nullptr || desc == nullptr) {
+            key.Append(TILING_CACHE_ABSENT);
+            continue;
+        }
+        const gert::Shape &origin = shape->GetOriginShape();
+        const gert::Shape &storage = shape->GetStorageShape();
+        key.Append(static_cast<uint64_t>(desc->GetDataType()) |
+                   static_cast<uint64_t>(desc->GetStorageFormat()) << 32);
+        key.Append(origin.GetDimNum() | storage.GetDimNum() << 32);
+        for (size_t d = 0; d < origin.GetDimNum(); d++) {
+            key.Append(static_cast<uint64_t>(origin.GetDim(d)));
+        }
+        for (size_t d = 0; d < storage.GetDimNum(); d++) {
+            key.Append(static_cast<uint64_t>(storage.GetDim(d)));
+        }
+    }
+    // 连接的输出及其 dtype(如 int32、int64 的 indices)
+    for (size_t i = 0; i < context->GetComputeNodeOutputNum(); i++) {
+        const gert::CompileTimeTensorDesc *desc = context->GetOutputDesc(i);
+        key.Append(context->GetOutputShape(i) == nullptr || desc == nullptr ?
+                   TILING_CACHE_ABSENT : static_cast<uint64_t>(desc->GetDataType()));
+    }
+    const gert::RuntimeAttrs *attrs = context->GetAttrs();
+    for (size_t i = 0; attr_types[i] != '\0'; i++) {
+        if (attr_types[i] == 'l') {
+            const gert::ContinuousVector *list = attrs->GetAttrPointer<gert::ContinuousVector>(i);
+            if (list == nullptr) {
+                key.Append(TILING_CACHE_ABSENT);
+                continue;
+            }
+            const int64_t *data = static_cast<const int64_t *>(list->GetData());
+            key.Append(list->GetSize());
+            for (size_t j = 0; j < list->GetSize(); j++) {
+                key.Append(static_cast<uint64_t>(data[j]));
+            }
+            continue;
+        }
+        if (attr_types[i] == 'i') {
+            const int64_t *value = attrs->GetAttrPointer<int64_t>(i);
+            key.Append(value == nullptr ? TILING_CACHE_ABSENT : static_cast<uint64_t>(*value));
+        } else if (attr_types[i] == 'b') {
+            const bool *value = attrs->GetAttrPointer<bool>(i);
+            key.Append(value == nullptr ? TILING_CACHE_ABSENT : static_cast<uint64_t>(*value));
+        } else if (attr_types[i] == 'f') {
+            const float *value = attrs->GetAttrPointer<float>(i);
+            uint32_t bits = 0;
+            if (value != nullptr) {
+                memcpy(&bits, value, sizeof(bits));
+            }
+            key.Append(value == nullptr ? TILING_CACHE_ABSENT : bits);
+        } else {
+            return false;
+        }
+    }
+    // 超出定长时 Append 丢弃后续的字，键不完整，不能缓存
+    return key.size < TILING_CACHE_KEY_WORDS;
+}
+
+// 以缓存包装 tiling 函数，失败的结果不缓存；tiling 数据容量不足以写回时重新切分
+inline ge::graphStatus CachedTiling(gert::TilingContext *context, TilingCache &cache, const char *attr_types,
+                                    ge::graphStatus (*tiling)(gert::TilingContext *))
+{
+    TilingCacheKey key;
+    if (!MakeTilingCacheKey(context, attr_types, key)) {
+        return tiling(context);
+    }
+    TilingCacheCounters &counters = GetTilingCacheCounters();
+    const TilingCacheEntry *entry = cache.Find(key);
+    gert::TilingData *raw = context->GetRawTilingData();
+    if (entry != nullptr && entry->data_size <= raw->GetCapacity()) {
+        counters.hits.fetch_add(1, std::memory_order_relaxed);
+        memcpy(raw->GetData(), entry->data, entry->data_size);
+        raw->SetDataSize(entry->data_size);
+        context->SetTilingKey(entry->tiling_key);
+        context->SetBlockDim(entry->block_dim);
+        context->GetWorkspaceSizes(1)[0] = entry->workspace_size;
+        return ge::GRAPH_SUCCESS;
+    }
+    counters.misses.fetch_add(1, std::memory_order_relaxed);
+    ge::graphStatus status = tiling(context);
+    if (status == ge::GRAPH_SUCCESS) {
+        cache.Store(key, context);
+    }
+    return status;
+}
+}
+
+// 由 arg_max_with_value 工程的 tiling_cache.cpp 导出
+extern "C" {
+uint64_t OptilingTilingCacheHits();
+uint64_t OptilingTilingCacheMisses();
+}
+
+#endif // TILING_CACHE_H
@@ -0,0 +1,123 @@
+
+#include "top_k_with_value_tiling.h"
+#include "register/op_def_registry.h"
+
+
+namespace optiling {
+// 每个 lane 在 UB 中维护有序的 k 个候选，k 受 UB 与逐候选的插入开销限制
+constexpr int64_t MAX_TOP_K = 8;
+// 取最小的 k 个时 tiling key 加 10
+constexpr uint64_t TILING_KEY_SMALLEST = 10;
+
+// 属性依次为 k、dimension、largest
+static ge::graphStatus TilingFunc(gert::TilingContext* context)
+{
+    TopKWithValueTilingData tiling;
+    ReduceWithIndexShape shape;
+    const gert::RuntimeAttrs *attrs = context->GetAttrs();
+    int64_t k = *attrs->GetAttrPointer<int64_t>(0);
+    int64_t dimension = *attrs->GetAttrPointer<int64_t>(1);
+    const bool *largest = attrs->GetAttrPointer<bool>(2);
+    if (ParseReduceShape(context->GetInputShape(0)->GetStorageShape(), dimension, shape) != ge::GRAPH_SUCCESS) {
+        return ge::GRAPH_FAILED;
+    }
+    if (k < 1 || k > MAX_TOP_K || k > shape.axis) {
+        return ge::GRAPH_FAILED;
+    }
+
+    uint32_t type_size = InputTypeSize(context);
+    uint32_t compute_size = ComputeTypeSize(context);
+    // 每个 lane 常驻 UB 的字节数：k 个候选值与 float 索引、k 个掩码(按字节上取整)、候选位置、
+    // 写出的 k 个 indices 与 values 各双缓冲，int32 还需差值与其 float 副本
+    uint32_t lane_bytes = k * (compute_size + sizeof(float) + 1) + sizeof(float);
+    lane_bytes += BUFFER_NUM * k * (sizeof(int32_t) + type_size);
+    if (context->GetInputDesc(0)->GetDataType() == ge::DT_INT32) {
+        lane_bytes += sizeof(int32_t) + sizeof(float);
+    }
+    // GATHER 写回前把 [k, lane] 交织为 [lane, k]：两张 gather 偏移表与交织结果；
+    // SPLIT 合并时 half 候选需 float 副本，另有尾段掩码
+    lane_bytes += k * 3 * sizeof(float) + 1;
+    uint64_t layout = SplitReduceLanes(context, shape, lane_bytes, tiling);
+    if (layout == 0) {
+        return ge::GRAPH_FAILED;
+    }
+    tiling.set_k(static_cast<uint32_t>(k));
+
+    context->SetTilingKey(layout + (*largest ? 0 : TILING_KEY_SMALLEST));
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+    size_t *currentWorkspace = context->GetWorkspaceSizes(1);
+    currentWorkspace[0] = 0;
+    return ge::GRAPH_SUCCESS;
+}
+}
+
+
+namespace ge {
+// indices 与 values 形状相同：归约维替换为 k，动态维与动态 rank 按原样传递
+static ge::graphStatus InferShape(gert::InferShapeContext* context)
+{
+    const gert::Shape *x_shape = context->GetInputShape(0);
+    const gert::RuntimeAttrs *attrs = context->GetAttrs();
+    int64_t k = *attrs->GetAttrPointer<int64_t>(0);
+    int64_t dimension = *attrs->GetAttrPointer<int64_t>(1);
+    int64_t dim_num = x_shape->GetDimNum();
+    bool unknown_rank = optiling::IsUnknownRank(*x_shape);
+    if (!unknown_rank && !optiling::NormalizeDimension(dim_num, dimension)) {
+        return GRAPH_FAILED;
+    }
+    for (size_t i = 0; i < 2; i++) {
+        gert::Shape *y_shape = context->GetOutputShape(i);
+        *y_shape = *x_shape;
+        if (!unknown_rank) {
+            y_shape->SetDim(dimension, k);
+        }
+    }
+    return GRAPH_SUCCESS;
+}
+
+static ge::graphStatus InferDataType(gert::InferDataTypeContext* context)
+{
+    return optiling::InferReduceWithIndexDataType(context);
+}
+}
+
+
+namespace ops {
+class TopKWithValue : public OpDef {
+public:
+    explicit TopKWithValue(const char* name) : OpDef(name)
+    {
+        this->Input("x")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_INT32, ge::DT_UINT8})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        // 沿归约维按从优到劣排列，值相等时索引小的在前
+        this->Output("indices")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_INT32, ge::DT_INT32, ge::DT_INT32, ge::DT_INT32})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Output("values")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_INT32, ge::DT_UINT8})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        // 1 <= k <= 8 且不超过归约维长度
+        this->Attr("k").Int();
+        this->Attr("dimension").AttrType(OPTIONAL).Int(-1);
+        // false 时取最小的 k 个
+        this->Attr("largest").AttrType(OPTIONAL).Bool(true);
+
+        this->SetInferShape(ge::InferShape).SetInferDataType(ge::InferDataType);
+
+        this->AICore()
+            .SetTiling(optiling::TilingFunc);
+        this->AICore().AddConfig("ascend910b");
+
+    }
+};
+
+OP_ADD(TopKWithValue);
+}
@@ -0,0 +1,23 @@
+#ifndef TOP_K_WITH_VALUE_TILING_H
+#define TOP_K_WITH_VALUE_TILING_H
+
+#include "reduce_with_index_tiling.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(TopKWithValueTilingData)
+  // 与 ReduceWithIndexTilingData 相同的切分，输出为 [outer, k, inner]
+  TILING_DATA_FIELD_DEF(uint32_t, outer);
+  TILING_DATA_FIELD_DEF(uint32_t, axis);
+  TILING_DATA_FIELD_DEF(uint32_t, inner);
+  TILING_DATA_FIELD_DEF(uint32_t, lane_length);
+  TILING_DATA_FIELD_DEF(uint32_t, axis_tile);
+  TILING_DATA_FIELD_DEF(uint32_t, group_num);
+  TILING_DATA_FIELD_DEF(uint32_t, block_groups);
+  TILING_DATA_FIELD_DEF(uint32_t, used_core_num);
+  TILING_DATA_FIELD_DEF(uint32_t, k);
+END_TILING_DATA_DEF;
+
+REGISTER_TILING_DATA_CLASS(TopKWithValue, TopKWithValueTilingData)
+}
+
+#endif // TOP_K_WITH_VALUE_TILING_H
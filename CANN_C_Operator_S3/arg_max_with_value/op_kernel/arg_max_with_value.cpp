@@ -1,6 +1,76 @@
-#include "kernel_operator.h"
+#include "reduce_with_index.h"
 
+template <bool LAST_INDEX, uint32_t LAYOUT, uint32_t OUTPUT, typename IDX = int32_t, typename TilingData>
+__aicore__ inline void RunArgMax(GM_ADDR x, GM_ADDR indices, GM_ADDR values, const TilingData &tilingData)
+{
+    KernelReduceWithIndex<DTYPE_X, MaxCompare, LAST_INDEX, LAYOUT, OUTPUT, IDX> op;
+    op.Init(x, indices, values, tilingData);
+    op.Process();
+}
+
+// tiling key = 布局 + 10 * select_last_index + 100 * 省略的输出(1 不写 values，2 不写 indices)
+// + 1000 * indices 为 int64
 extern "C" __global__ __aicore__ void arg_max_with_value(GM_ADDR x, GM_ADDR indices, GM_ADDR values, GM_ADDR workspace, GM_ADDR tiling) {
     GET_TILING_DATA(tiling_data, tiling);
-    // TODO: user kernel impl
-}
\ No newline at end of file
+    if (TILING_KEY_IS(1)) {
+        RunArgMax<false, LAYOUT_ROW, OUTPUT_BOTH>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(2)) {
+        RunArgMax<false, LAYOUT_GATHER, OUTPUT_BOTH>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(3)) {
+        RunArgMax<false, LAYOUT_SPLIT, OUTPUT_BOTH>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(11)) {
+        RunArgMax<true, LAYOUT_ROW, OUTPUT_BOTH>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(12)) {
+        RunArgMax<true, LAYOUT_GATHER, OUTPUT_BOTH>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(13)) {
+        RunArgMax<true, LAYOUT_SPLIT, OUTPUT_BOTH>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(101)) {
+        RunArgMax<false, LAYOUT_ROW, OUTPUT_INDICES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(102)) {
+        RunArgMax<false, LAYOUT_GATHER, OUTPUT_INDICES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(103)) {
+        RunArgMax<false, LAYOUT_SPLIT, OUTPUT_INDICES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(111)) {
+        RunArgMax<true, LAYOUT_ROW, OUTPUT_INDICES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(112)) {
+        RunArgMax<true, LAYOUT_GATHER, OUTPUT_INDICES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(113)) {
+        RunArgMax<true, LAYOUT_SPLIT, OUTPUT_INDICES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(201)) {
+        RunArgMax<false, LAYOUT_ROW, OUTPUT_VALUES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(202)) {
+        RunArgMax<false, LAYOUT_GATHER, OUTPUT_VALUES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(203)) {
+        RunArgMax<false, LAYOUT_SPLIT, OUTPUT_VALUES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(211)) {
+        RunArgMax<true, LAYOUT_ROW, OUTPUT_VALUES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(212)) {
+        RunArgMax<true, LAYOUT_GATHER, OUTPUT_VALUES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(213)) {
+        RunArgMax<true, LAYOUT_SPLIT, OUTPUT_VALUES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1001)) {
+        RunArgMax<false, LAYOUT_ROW, OUTPUT_BOTH, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1002)) {
+        RunArgMax<false, LAYOUT_GATHER, OUTPUT_BOTH, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1003)) {
+        RunArgMax<false, LAYOUT_SPLIT, OUTPUT_BOTH, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1011)) {
+        RunArgMax<true, LAYOUT_ROW, OUTPUT_BOTH, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1012)) {
+        RunArgMax<true, LAYOUT_GATHER, OUTPUT_BOTH, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1013)) {
+        RunArgMax<true, LAYOUT_SPLIT, OUTPUT_BOTH, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1101)) {
+        RunArgMax<false, LAYOUT_ROW, OUTPUT_INDICES, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1102)) {
+        RunArgMax<false, LAYOUT_GATHER, OUTPUT_INDICES, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1103)) {
+        RunArgMax<false, LAYOUT_SPLIT, OUTPUT_INDICES, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1111)) {
+        RunArgMax<true, LAYOUT_ROW, OUTPUT_INDICES, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1112)) {
+        RunArgMax<true, LAYOUT_GATHER, OUTPUT_INDICES, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1113)) {
+        RunArgMax<true, LAYOUT_SPLIT, OUTPUT_INDICES, int64_t>(x, indices, values, tiling_data);
+    }
+}
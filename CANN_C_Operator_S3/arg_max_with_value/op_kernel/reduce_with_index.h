@@ -0,0 +1,553 @@
+#ifndef REDUCE_WITH_INDEX_H
+#define REDUCE_WITH_INDEX_H
+
+#include "kernel_operator.h"
+using namespace AscendC;
+
+constexpr int32_t BUFFER_NUM = 2;
+// 每组 lane 数按 128 对齐，half 与 float 的 Compare 都是整数个 256B
+constexpr uint32_t LANE_ALIGN = 128;
+// 与 tiling 一致：tiling key = 布局 + 10 * 是否取最后一个索引 + 100 * 省略的输出(0 两者都写，1 只写 indices，2 只写 values)
+// + 1000 * indices 为 int64
+// inner > 1：lane 沿 inner 方向，逐行搬入，每行即各 lane 的一个候选
+constexpr uint32_t LAYOUT_ROW = 1;
+// inner == 1：lane 为各行，搬入若干行的一段后逐列 gather 出候选
+constexpr uint32_t LAYOUT_GATHER = 2;
+// inner == 1 且行数少、归约轴长：每行按 lane 宽度切段，lane 内归约后再标量合并各 lane
+constexpr uint32_t LAYOUT_SPLIT = 3;
+constexpr uint32_t OUTPUT_INDICES = 1;
+constexpr uint32_t OUTPUT_VALUES = 2;
+constexpr uint32_t OUTPUT_BOTH = OUTPUT_INDICES | OUTPUT_VALUES;
+
+__aicore__ inline uint32_t CeilDiv(uint32_t value, uint32_t factor)
+{
+    return (value + factor - 1) / factor;
+}
+
+template <HardEvent EVENT>
+__aicore__ inline void WaitPipe(TPipe *pipe)
+{
+    event_t eventId = static_cast<event_t>(pipe->FetchEventID(EVENT));
+    SetFlag<EVENT>(eventId);
+    WaitFlag<EVENT>(eventId);
+}
+
+// 比较所用的类型：uint8 转为 half，0~255 在 half 中精确表示；bf16 在 UB 内展宽为 float 比较，
+// 图中无需再插入 Cast
+template <typename T>
+struct ComputeType {
+    using Type = T;
+};
+template <>
+struct ComputeType<uint8_t> {
+    using Type = half;
+};
+template <>
+struct ComputeType<bfloat16_t> {
+    using Type = float;
+};
+
+// SPLIT 标量合并时比较的索引类型：int64 索引按段号换算为 64 位位置
+template <bool STEP_INDEX>
+struct MergeIndexType {
+    using Type = float;
+};
+template <>
+struct MergeIndexType<true> {
+    using Type = uint64_t;
+};
+
+// 比较器：Reduce 为逐元素取优，Better 用于 SPLIT 的标量合并；
+// KEEP_FIRST / KEEP_LAST 为保留当前最优(不更新索引)的条件，相等时分别保留旧索引与取新索引；
+// BETTER 为候选严格优于当前值，TopKWithValue 按其插入
+struct MaxCompare {
+    template <typename T>
+    __aicore__ static inline void Reduce(const LocalTensor<T> &dst, const LocalTensor<T> &src0,
+                                         const LocalTensor<T> &src1, uint32_t count)
+    {
+        Max(dst, src0, src1, count);
+    }
+    template <typename T>
+    __aicore__ static inline bool Better(T a, T b)
+    {
+        return a > b;
+    }
+    static constexpr CMPMODE KEEP_FIRST = CMPMODE::LE;
+    static constexpr CMPMODE KEEP_LAST = CMPMODE::LT;
+    static constexpr CMPMODE BETTER = CMPMODE::GT;
+};
+
+struct MinCompare {
+    template <typename T>
+    __aicore__ static inline void Reduce(const LocalTensor<T> &dst, const LocalTensor<T> &src0,
+                                         const LocalTensor<T> &src1, uint32_t count)
+    {
+        Min(dst, src0, src1, count);
+    }
+    template <typename T>
+    __aicore__ static inline bool Better(T a, T b)
+    {
+        return a < b;
+    }
+    static constexpr CMPMODE KEEP_FIRST = CMPMODE::GE;
+    static constexpr CMPMODE KEEP_LAST = CMPMODE::GT;
+    static constexpr CMPMODE BETTER = CMPMODE::LT;
+};
+
+// 沿归约轴求最值及其索引，多个归约维时为其展平后的位置。x 视为 [outer, axis, inner]，输出为 [outer, inner]。
+// 每个 lane 维护当前最优值与索引，逐个候选做向量比较与选择，不做逐元素的标量分支；
+// 各组 lane 相互独立，按组均分到各核。
+// CMP 为比较器，LAST_INDEX 为相等时取最后一个索引，OUTPUT 为写出的输出，IDX 为 indices 的类型(int32 或 int64)；
+// 偏移按 64 位计算，x 可超过 2^32 个元素；x 按 tiling 给出的 outer、axis 方向 stride 读取，可为非连续的视图。
+// outer 与 axis 各可由不相接的两段维度组成(多个归约维、转置后的视图)，每次搬运不跨段。
+// FRACTAL_NZ 的 x 在 tiling 中展开为 [..., M, N1, C0] 的视图：沿最后一维归约时 axis 的两段即分形列块与块内的列，
+// 各行在一个列块内间隔 C0、首尾相接，GATHER 一次搬入整块；N 不是 C0 的倍数时 axis 为 N，最后一块只读有效列
+template <typename T, typename CMP, bool LAST_INDEX, uint32_t LAYOUT, uint32_t OUTPUT, typename IDX = int32_t>
+class KernelReduceWithIndex {
+public:
+    using CT = typename ComputeType<T>::Type;
+    // SPLIT 写 int64 索引时 lane 内只记段号，float 可精确表示 2^24 段，归约轴可超过 2^24
+    static constexpr bool STEP_INDEX = LAYOUT == LAYOUT_SPLIT && IsSameType<IDX, int64_t>::value;
+    using MergeIndex = typename MergeIndexType<STEP_INDEX>::Type;
+
+    __aicore__ inline KernelReduceWithIndex() {}
+
+    // 初始化
+    template <typename TilingData>
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR indices, GM_ADDR values, const TilingData &tilingData)
+    {
+        outer = tilingData.outer;
+        axis = tilingData.axis;
+        inner = tilingData.inner;
+        outerStride = tilingData.outer_stride;
+        axisStride = tilingData.axis_stride;
+        outerLow = tilingData.outer_low;
+        axisLow = tilingData.axis_low;
+        outerHighStride = tilingData.outer_high_stride;
+        axisHighStride = tilingData.axis_high_stride;
+        laneLength = tilingData.lane_length;
+        axisTile = tilingData.axis_tile;
+        groupStart = GetBlockIdx() * tilingData.block_groups;
+        groupCount = tilingData.group_num - groupStart < tilingData.block_groups ? tilingData.group_num - groupStart
+                                                                                : tilingData.block_groups;
+
+        xGlobal.SetGlobalBuffer((__gm__ T *)x);
+        indicesGlobal.SetGlobalBuffer((__gm__ IDX *)indices);
+        valuesGlobal.SetGlobalBuffer((__gm__ T *)values);
+
+        if constexpr (LAYOUT == LAYOUT_GATHER) {
+            // 每行一段 axisTile 个元素，按 32B 对齐存放
+            rowStride = axisTile;
+            pipe.InitBuffer(inQueue, BUFFER_NUM, laneLength * rowStride * sizeof(T));
+            if constexpr (!IsSameType<T, CT>::value) {
+                pipe.InitBuffer(castBuf, laneLength * rowStride * sizeof(CT));
+            }
+            pipe.InitBuffer(offsetBuf, 2 * laneLength * sizeof(int32_t));
+            pipe.InitBuffer(rowBuf, laneLength * sizeof(CT));
+        } else {
+            pipe.InitBuffer(inQueue, BUFFER_NUM, axisTile * laneLength * sizeof(T));
+            if constexpr (!IsSameType<T, CT>::value) {
+                pipe.InitBuffer(rowBuf, laneLength * sizeof(CT));
+            }
+        }
+        if constexpr (LAYOUT == LAYOUT_SPLIT) {
+            // lane 内位置、候选索引、标量合并用的 float 最优值，以及待写回的各行索引与最优值
+            pipe.InitBuffer(splitBuf, laneLength * (3 * sizeof(float) + sizeof(IDX) + sizeof(CT)));
+        }
+        if constexpr (IsSameType<CT, int32_t>::value) {
+            pipe.InitBuffer(diffBuf, laneLength * (sizeof(int32_t) + sizeof(float)));
+        }
+        pipe.InitBuffer(bestBuf, laneLength * sizeof(CT));
+        pipe.InitBuffer(indexBuf, laneLength * sizeof(float));
+        pipe.InitBuffer(maskBuf, laneLength / 8);
+        if constexpr ((OUTPUT & OUTPUT_INDICES) != 0) {
+            pipe.InitBuffer(indicesQueue, BUFFER_NUM, laneLength * sizeof(IDX));
+        }
+        if constexpr ((OUTPUT & OUTPUT_VALUES) != 0) {
+            pipe.InitBuffer(valuesQueue, BUFFER_NUM, laneLength * sizeof(T));
+        }
+    }
+
+    __aicore__ inline void Process()
+    {
+        if (groupCount == 0) {
+            return;
+        }
+        if constexpr (LAYOUT == LAYOUT_ROW) {
+            ProcessRow();
+        } else if constexpr (LAYOUT == LAYOUT_GATHER) {
+            ProcessGather();
+        } else {
+            ProcessSplit();
+        }
+    }
+
+private:
+    // 一组为某个 outer 下 inner 方向连续的 laneLength 个元素，搬入的每一行即各 lane 的一个候选
+    __aicore__ inline void ProcessRow()
+    {
+        uint32_t innerGroups = CeilDiv(inner, laneLength);
+        for (uint32_t g = groupStart; g < groupStart + groupCount; g++) {
+            uint32_t o = g / innerGroups;
+            uint32_t i0 = (g % innerGroups) * laneLength;
+            uint32_t valid = inner - i0 < laneLength ? inner - i0 : laneLength;
+            uint64_t base = OuterOffset(o) + i0;
+            uint32_t rows;
+            for (uint32_t j0 = 0; j0 < axis; j0 += rows) {
+                rows = AxisRun(j0);
+                // inner 方向不足一组时只搬有效部分，其余 lane 的结果不写回
+                LocalTensor<T> xLocal = inQueue.AllocTensor<T>();
+                uint32_t blockLen = valid * sizeof(T);
+                uint32_t dstStride = (laneLength * sizeof(T) - CeilDiv(blockLen, ONE_BLK_SIZE) * ONE_BLK_SIZE) /
+                                     ONE_BLK_SIZE;
+                DataCopyExtParams copyParams{static_cast<uint16_t>(rows), blockLen,
+                                             static_cast<uint32_t>((axisStride - valid) * sizeof(T)), dstStride, 0};
+                DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+                DataCopyPad(xLocal, xGlobal[base + AxisOffset(j0)], copyParams, padParams);
+                inQueue.EnQue(xLocal);
+                xLocal = inQueue.DeQue<T>();
+                for (uint32_t r = 0; r < rows; r++) {
+                    LocalTensor<CT> row = ToCompute(xLocal[r * laneLength]);
+                    if (j0 + r == 0) {
+                        Start(row);
+                    } else {
+                        Update(row, j0 + r);
+                    }
+                }
+                inQueue.FreeTensor(xLocal);
+            }
+            LocalTensor<CT> best = bestBuf.Get<CT>();
+            LocalTensor<float> index = indexBuf.Get<float>();
+            Emit(best, index, static_cast<uint64_t>(o) * inner + i0, valid);
+        }
+    }
+
+    // 一组为同一段内连续的 laneLength 行，每行搬入一段 axisTile 个元素，按行首偏移逐列 gather 成各 lane 的候选
+    __aicore__ inline void ProcessGather()
+    {
+        LocalTensor<int32_t> rowBase = offsetBuf.Get<int32_t>();
+        LocalTensor<int32_t> offset = rowBase[laneLength];
+        ArithProgression<int32_t>(rowBase, 0, static_cast<int32_t>(rowStride * sizeof(CT)), laneLength);
+        uint32_t lowGroups = CeilDiv(outerLow, laneLength);
+        for (uint32_t g = groupStart; g < groupStart + groupCount; g++) {
+            uint32_t low = (g % lowGroups) * laneLength;
+            uint32_t r0 = (g / lowGroups) * outerLow + low;
+            uint32_t valid = outerLow - low < laneLength ? outerLow - low : laneLength;
+            uint64_t base = OuterOffset(r0);
+            uint32_t cols;
+            for (uint32_t j0 = 0; j0 < axis; j0 += cols) {
+                cols = AxisRun(j0);
+                LocalTensor<T> xLocal = inQueue.AllocTensor<T>();
+                uint32_t blockLen = cols * sizeof(T);
+                uint32_t dstStride = (rowStride * sizeof(T) - CeilDiv(blockLen, ONE_BLK_SIZE) * ONE_BLK_SIZE) /
+                                     ONE_BLK_SIZE;
+                uint16_t blockCount = static_cast<uint16_t>(valid);
+                // 各行在 GM 中首尾相接且恰好占满 UB 中的一行(如 FRACTAL_NZ 的一个分形列块)时合并为一次搬运
+                if (outerStride == cols && rowStride == cols) {
+                    blockLen *= valid;
+                    blockCount = 1;
+                }
+                DataCopyExtParams copyParams{blockCount, blockLen,
+                                             static_cast<uint32_t>((outerStride - cols) * sizeof(T)), dstStride, 0};
+                DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+                DataCopyPad(xLocal, xGlobal[base + AxisOffset(j0)], copyParams, padParams);
+                inQueue.EnQue(xLocal);
+                xLocal = inQueue.DeQue<T>();
+                LocalTensor<CT> tile;
+                if constexpr (IsSameType<T, CT>::value) {
+                    tile = xLocal;
+                } else {
+                    tile = castBuf.Get<CT>();
+                    Cast(tile, xLocal, RoundMode::CAST_NONE, laneLength * rowStride);
+                }
+                LocalTensor<CT> row = rowBuf.Get<CT>();
+                for (uint32_t c = 0; c < cols; c++) {
+                    Adds(offset, rowBase, static_cast<int32_t>(c * sizeof(CT)), laneLength);
+                    Gather(row, tile, offset.ReinterpretCast<uint32_t>(), 0, laneLength);
+                    if (j0 + c == 0) {
+                        Start(row);
+                    } else {
+                        Update(row, j0 + c);
+                    }
+                }
+                inQueue.FreeTensor(xLocal);
+            }
+            LocalTensor<CT> best = bestBuf.Get<CT>();
+            LocalTensor<float> index = indexBuf.Get<float>();
+            Emit(best, index, r0, valid);
+        }
+    }
+
+    // 一组为一行：按 laneLength 切段，lane w 依次看到位置 w, w + laneLength, ... 的元素；
+    // 不足一段的尾部改为取最后 laneLength 个元素，与前一段重叠的元素重复比较不影响结果。
+    // 各 lane 的结果再按比较器与索引规则标量合并，每 laneLength 行写回一次
+    __aicore__ inline void ProcessSplit()
+    {
+        LocalTensor<float> lanePos = splitBuf.Get<float>();
+        LocalTensor<float> candidate = lanePos[laneLength];
+        LocalTensor<float> mergeValue = lanePos[2 * laneLength];
+        LocalTensor<float> stageIndex = lanePos[3 * laneLength];
+        LocalTensor<CT> stageValue =
+            lanePos[(3 + sizeof(IDX) / sizeof(float)) * laneLength].template ReinterpretCast<CT>();
+        ArithProgression<float>(lanePos, 0.0f, 1.0f, laneLength);
+        fullSteps = axis / laneLength;
+        // 归约轴可接近 2^32，不用 CeilDiv 以免回绕
+        uint32_t stepNum = fullSteps + (axis % laneLength != 0 ? 1 : 0);
+        uint32_t staged = 0;
+        for (uint32_t g = groupStart; g < groupStart + groupCount; g++) {
+            uint64_t base = OuterOffset(g);
+            uint32_t s0 = 0;
+            while (s0 < stepNum) {
+                uint32_t steps = stepNum - s0 < axisTile ? stepNum - s0 : axisTile;
+                // 尾段单独搬入，保证每次搬入的各段首尾相接
+                if (s0 < fullSteps && s0 + steps > fullSteps) {
+                    steps = fullSteps - s0;
+                }
+                uint32_t start = s0 < fullSteps ? s0 * laneLength : axis - laneLength;
+                LocalTensor<T> xLocal = inQueue.AllocTensor<T>();
+                DataCopyExtParams copyParams{1, static_cast<uint32_t>(steps * laneLength * sizeof(T)), 0, 0, 0};
+                DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+                DataCopyPad(xLocal, xGlobal[base + start], copyParams, padParams);
+                inQueue.EnQue(xLocal);
+                xLocal = inQueue.DeQue<T>();
+                for (uint32_t s = 0; s < steps; s++) {
+                    LocalTensor<CT> row = ToCompute(xLocal[s * laneLength]);
+                    if (s0 + s == 0) {
+                        Start(row);
+                        if constexpr (!STEP_INDEX) {
+                            Adds(indexBuf.Get<float>(), lanePos, 0.0f, laneLength);
+                        }
+                    } else if constexpr (STEP_INDEX) {
+                        Update(row, s0 + s);
+                    } else {
+                        Adds(candidate, lanePos, static_cast<float>(start + s * laneLength), laneLength);
+                        Update(row, candidate);
+                    }
+                }
+                inQueue.FreeTensor(xLocal);
+                s0 += steps;
+            }
+
+            MergeLanes(mergeValue, stageValue, stageIndex, staged);
+            staged++;
+            if (staged == laneLength || g == groupStart + groupCount - 1) {
+                WaitPipe<HardEvent::S_V>(&pipe);
+                if constexpr (STEP_INDEX) {
+                    Emit(stageValue, stageIndex.template ReinterpretCast<int64_t>(), g + 1 - staged, staged);
+                } else {
+                    Emit(stageValue, stageIndex, g + 1 - staged, staged);
+                }
+                staged = 0;
+            }
+        }
+    }
+
+    // 第 o 个 outer、归约轴上第 j 个位置在 GM 中的偏移
+    __aicore__ inline uint64_t OuterOffset(uint32_t o)
+    {
+        return (o / outerLow) * outerHighStride + (o % outerLow) * outerStride;
+    }
+
+    __aicore__ inline uint64_t AxisOffset(uint32_t j)
+    {
+        return (j / axisLow) * axisHighStride + (j % axisLow) * axisStride;
+    }
+
+    // 从归约轴上位置 j 起一次搬入的长度：不超过 axisTile，也不跨 axis 的段
+    __aicore__ inline uint32_t AxisRun(uint32_t j)
+    {
+        uint32_t run = axisLow - j % axisLow;
+        run = axis - j < run ? axis - j : run;
+        return run < axisTile ? run : axisTile;
+    }
+
+    // 各 lane 的最优值转为标量可比较的类型后逐个合并，结果暂存到第 slot 个位置
+    __aicore__ inline void MergeLanes(LocalTensor<float> &mergeValue, LocalTensor<CT> &stageValue,
+                                      LocalTensor<float> &stageIndex, uint32_t slot)
+    {
+        LocalTensor<CT> best = bestBuf.Get<CT>();
+        LocalTensor<float> index = indexBuf.Get<float>();
+        if constexpr (IsSameType<CT, half>::value) {
+            Cast(mergeValue, best, RoundMode::CAST_NONE, laneLength);
+        }
+        WaitPipe<HardEvent::V_S>(&pipe);
+        uint32_t bestLane = 0;
+        MergeIndex bestIndex = LanePosition(index, 0);
+        for (uint32_t w = 1; w < laneLength; w++) {
+            MergeIndex candIndex = LanePosition(index, w);
+            bool better;
+            bool equal;
+            if constexpr (IsSameType<CT, half>::value) {
+                float a = mergeValue.GetValue(w);
+                float b = mergeValue.GetValue(bestLane);
+                better = CMP::Better(a, b);
+                equal = a == b;
+            } else {
+                CT a = best.GetValue(w);
+                CT b = best.GetValue(bestLane);
+                better = CMP::Better(a, b);
+                equal = a == b;
+            }
+            if (better || (equal && (LAST_INDEX ? candIndex > bestIndex : candIndex < bestIndex))) {
+                bestLane = w;
+                bestIndex = candIndex;
+            }
+        }
+        stageValue.SetValue(slot, best.GetValue(bestLane));
+        if constexpr (STEP_INDEX) {
+            stageIndex.template ReinterpretCast<int64_t>().SetValue(slot, static_cast<int64_t>(bestIndex));
+        } else {
+            stageIndex.SetValue(slot, bestIndex);
+        }
+    }
+
+    // lane w 的最优值在归约轴上的位置；STEP_INDEX 时 index 中为段号，尾段起点为 axis - laneLength
+    __aicore__ inline MergeIndex LanePosition(const LocalTensor<float> &index, uint32_t w)
+    {
+        if constexpr (STEP_INDEX) {
+            uint32_t step = static_cast<uint32_t>(index.GetValue(w));
+            uint64_t start = step < fullSteps ? static_cast<uint64_t>(step) * laneLength : axis - laneLength;
+            return start + w;
+        } else {
+            return index.GetValue(w);
+        }
+    }
+
+    __aicore__ inline LocalTensor<CT> ToCompute(const LocalTensor<T> &src)
+    {
+        if constexpr (IsSameType<T, CT>::value) {
+            return src;
+        } else {
+            LocalTensor<CT> row = rowBuf.Get<CT>();
+            Cast(row, src, RoundMode::CAST_NONE, laneLength);
+            return row;
+        }
+    }
+
+    // 第一个候选直接作为当前最优，索引为 0
+    __aicore__ inline void Start(const LocalTensor<CT> &row)
+    {
+        LocalTensor<CT> best = bestBuf.Get<CT>();
+        DataCopy(best, row, laneLength);
+        Duplicate(indexBuf.Get<float>(), 0.0f, laneLength);
+    }
+
+    // 生成保留当前最优的掩码并更新最优值。
+    // int32 不能直接向量比较，改为比较差值：取优结果与参照值(取第一个时为当前最优，取最后一个时为候选)
+    // 之差是否为 0，非零整数转为 float 仍非零，溢出回绕也不会得到 0
+    __aicore__ inline void CompareBest(const LocalTensor<CT> &row)
+    {
+        LocalTensor<CT> best = bestBuf.Get<CT>();
+        LocalTensor<uint8_t> mask = maskBuf.Get<uint8_t>();
+        if constexpr (IsSameType<CT, int32_t>::value) {
+            LocalTensor<int32_t> diff = diffBuf.Get<int32_t>();
+            LocalTensor<float> diffFloat = diff[laneLength].template ReinterpretCast<float>();
+            CMP::Reduce(diff, row, best, laneLength);
+            Sub(diff, diff, LAST_INDEX ? row : best, laneLength);
+            Cast(diffFloat, diff, RoundMode::CAST_NONE, laneLength);
+            CompareScalar(mask, diffFloat, 0.0f, LAST_INDEX ? CMPMODE::NE : CMPMODE::EQ, laneLength);
+        } else {
+            Compare(mask, row, best, LAST_INDEX ? CMP::KEEP_LAST : CMP::KEEP_FIRST, laneLength);
+        }
+        CMP::Reduce(best, row, best, laneLength);
+    }
+
+    // 候选位于归约轴上的同一位置；不写 indices 时只需逐元素取优
+    __aicore__ inline void Update(const LocalTensor<CT> &row, uint32_t position)
+    {
+        if constexpr ((OUTPUT & OUTPUT_INDICES) == 0) {
+            CMP::Reduce(bestBuf.Get<CT>(), row, bestBuf.Get<CT>(), laneLength);
+            return;
+        }
+        CompareBest(row);
+        LocalTensor<float> index = indexBuf.Get<float>();
+        Select(index, maskBuf.Get<uint8_t>(), index, static_cast<float>(position),
+               SELMODE::VSEL_TENSOR_SCALAR_MODE, laneLength);
+    }
+
+    // 各 lane 的候选位置不同
+    __aicore__ inline void Update(const LocalTensor<CT> &row, const LocalTensor<float> &position)
+    {
+        if constexpr ((OUTPUT & OUTPUT_INDICES) == 0) {
+            CMP::Reduce(bestBuf.Get<CT>(), row, bestBuf.Get<CT>(), laneLength);
+            return;
+        }
+        CompareBest(row);
+        LocalTensor<float> index = indexBuf.Get<float>();
+        Select(index, maskBuf.Get<uint8_t>(), index, position, SELMODE::VSEL_TENSOR_TENSOR_MODE, laneLength);
+    }
+
+    // 写回 count 个结果，起始于输出的第 offset 个元素；index 为 float 时转为 IDX，
+    // 为 int64 时是 SPLIT 合并后已换算好的位置，直接复制
+    template <typename I>
+    __aicore__ inline void Emit(const LocalTensor<CT> &value, const LocalTensor<I> &index, uint64_t offset,
+                                uint32_t count)
+    {
+        if constexpr ((OUTPUT & OUTPUT_INDICES) != 0) {
+            LocalTensor<IDX> indicesLocal = indicesQueue.AllocTensor<IDX>();
+            if constexpr (IsSameType<I, float>::value) {
+                Cast(indicesLocal, index, RoundMode::CAST_RINT, laneLength);
+            } else {
+                DataCopy(indicesLocal.template ReinterpretCast<int32_t>(), index.template ReinterpretCast<int32_t>(),
+                         2 * laneLength);
+            }
+            indicesQueue.EnQue(indicesLocal);
+            indicesLocal = indicesQueue.DeQue<IDX>();
+            DataCopyExtParams copyParams{1, static_cast<uint32_t>(count * sizeof(IDX)), 0, 0, 0};
+            DataCopyPad(indicesGlobal[offset], indicesLocal, copyParams);
+            indicesQueue.FreeTensor(indicesLocal);
+        }
+        if constexpr ((OUTPUT & OUTPUT_VALUES) != 0) {
+            LocalTensor<T> valuesLocal = valuesQueue.AllocTensor<T>();
+            if constexpr (IsSameType<T, CT>::value) {
+                DataCopy(valuesLocal, value, laneLength);
+            } else if constexpr (IsSameType<T, bfloat16_t>::value) {
+                // 最优值由 bf16 展宽而来，转回时精确；float 转 bf16 须指定舍入
+                Cast(valuesLocal, value, RoundMode::CAST_RINT, laneLength);
+            } else {
+                Cast(valuesLocal, value, RoundMode::CAST_NONE, laneLength);
+            }
+            valuesQueue.EnQue(valuesLocal);
+            valuesLocal = valuesQueue.DeQue<T>();
+            DataCopyExtParams copyParams{1, static_cast<uint32_t>(count * sizeof(T)), 0, 0, 0};
+            DataCopyPad(valuesGlobal[offset], valuesLocal, copyParams);
+            valuesQueue.FreeTensor(valuesLocal);
+        }
+    }
+
+private:
+    TPipe pipe;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueue;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> indicesQueue;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> valuesQueue;
+    TBuf<QuePosition::VECCALC> castBuf;
+    TBuf<QuePosition::VECCALC> offsetBuf;
+    TBuf<QuePosition::VECCALC> rowBuf;
+    TBuf<QuePosition::VECCALC> splitBuf;
+    TBuf<QuePosition::VECCALC> diffBuf;
+    TBuf<QuePosition::VECCALC> bestBuf;
+    TBuf<QuePosition::VECCALC> indexBuf;
+    TBuf<QuePosition::VECCALC> maskBuf;
+
+    GlobalTensor<T> xGlobal;
+    GlobalTensor<IDX> indicesGlobal;
+    GlobalTensor<T> valuesGlobal;
+
+    uint32_t outer;
+    uint32_t axis;
+    uint32_t inner;
+    uint64_t outerStride;
+    uint64_t axisStride;
+    uint32_t outerLow;
+    uint32_t axisLow;
+    uint64_t outerHighStride;
+    uint64_t axisHighStride;
+    uint32_t laneLength;
+    uint32_t axisTile;
+    uint32_t rowStride;
+    uint32_t fullSteps;
+    uint32_t groupStart;
+    uint32_t groupCount;
+};
+
+#endif // REDUCE_WITH_INDEX_H
@@ -0,0 +1,296 @@
+#include "reduce_with_index.h"
+
+// 与 tiling 一致：各段结果攒够该数目后写回一次
+constexpr uint32_t STAGE_LENGTH = 1024;
+// workspace 中每核一个槽位(8 个 int32，共 32B)：本核开头那段的编号(没有时为 -1)、部分结果的位置与值
+constexpr uint32_t SLOT_NUM = 8;
+constexpr int32_t NO_SEGMENT = -1;
+// 对齐后多出的前缀置为 -inf，按位写入
+constexpr uint16_t NEG_INF_HALF = 0xFC00;
+constexpr uint32_t NEG_INF_FLOAT = 0xFF800000;
+
+// 按 offsets 划分的变长段上求最大值及其段内位置。
+// 各核分到等长的一段元素，负责起点落在其中的段，逐块搬入后对块内每段的部分用带索引的 ReduceMax 规约，
+// 不按最长的段补齐。段跨过核的边界时，后面的核把开头那部分的结果写到 workspace 的槽位，
+// 全核同步后由拥有该段的核按核号顺序合并；位置递增地合并，值相等时保留先出现的
+template <typename T>
+class KernelSegmentArgMaxWithValue {
+public:
+    __aicore__ inline KernelSegmentArgMaxWithValue() {}
+
+    template <typename TilingData>
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR offsets, GM_ADDR indices, GM_ADDR values, GM_ADDR workspace,
+                                const TilingData &tilingData)
+    {
+        totalLength = tilingData.total_length;
+        segmentNum = tilingData.segment_num;
+        tileLength = tilingData.tile_length;
+        usedCoreNum = tilingData.used_core_num;
+        blockIdx = GetBlockIdx();
+        begin = blockIdx * tilingData.block_length;
+        end = totalLength - begin < tilingData.block_length ? totalLength : begin + tilingData.block_length;
+
+        xGlobal.SetGlobalBuffer((__gm__ T *)x, totalLength);
+        offsetsGlobal.SetGlobalBuffer((__gm__ int32_t *)offsets, segmentNum + 1);
+        indicesGlobal.SetGlobalBuffer((__gm__ int32_t *)indices, segmentNum);
+        valuesGlobal.SetGlobalBuffer((__gm__ T *)values, segmentNum);
+        slotGlobal.SetGlobalBuffer((__gm__ int32_t *)workspace, usedCoreNum * SLOT_NUM);
+
+        pipe.InitBuffer(inQueue, BUFFER_NUM, tileLength * sizeof(T));
+        pipe.InitBuffer(workBuf, tileLength * sizeof(T));
+        pipe.InitBuffer(maxBuf, ONE_BLK_SIZE);
+        pipe.InitBuffer(stageBuf, STAGE_LENGTH * (sizeof(int32_t) + sizeof(T)));
+        pipe.InitBuffer(slotBuf, CeilDiv(usedCoreNum * SLOT_NUM * sizeof(int32_t), ONE_BLK_SIZE) * ONE_BLK_SIZE);
+    }
+
+    __aicore__ inline void Process()
+    {
+        // 本核拥有起点落在 [begin, end) 的段，最后一个核还拥有起点为 totalLength 的空段
+        uint32_t ownBegin = LowerBound(begin);
+        ownEnd = blockIdx == usedCoreNum - 1 ? segmentNum : LowerBound(end);
+        stageStart = ownBegin;
+        staged = 0;
+        slotSegment = NO_SEGMENT;
+        if (begin < end && ownBegin > 0 && static_cast<uint32_t>(offsetsGlobal.GetValue(ownBegin)) > begin) {
+            // begin 落在前一个核拥有的段中间，先算这一段在本核内的部分
+            segment = ownBegin - 1;
+            segmentStart = static_cast<uint32_t>(offsetsGlobal.GetValue(segment));
+            segmentStop = static_cast<uint32_t>(offsetsGlobal.GetValue(ownBegin));
+            hasBest = false;
+        } else {
+            segment = ownBegin;
+            OpenSegment();
+        }
+        leading = segment < ownBegin;
+
+        for (uint32_t t0 = begin; t0 < end; t0 += tileLength) {
+            uint32_t length = end - t0 < tileLength ? end - t0 : tileLength;
+            LocalTensor<T> xLocal = inQueue.AllocTensor<T>();
+            DataCopyExtParams copyParams{1, static_cast<uint32_t>(length * sizeof(T)), 0, 0, 0};
+            DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+            DataCopyPad(xLocal, xGlobal[t0], copyParams, padParams);
+            inQueue.EnQue(xLocal);
+            xLocal = inQueue.DeQue<T>();
+            uint32_t p = t0;
+            while (p < t0 + length) {
+                uint32_t stop = segmentStop < t0 + length ? segmentStop : t0 + length;
+                ReducePiece(xLocal, p - t0, stop - p, t0);
+                p = stop;
+                if (p == segmentStop) {
+                    CloseSegment();
+                }
+            }
+            inQueue.FreeTensor(xLocal);
+        }
+
+        // 开头那段延续到本核末尾时同样记入槽位；每个核都写槽位，拥有跨核段的核据此顺序合并
+        if (leading) {
+            KeepSlot();
+        }
+        WriteSlot();
+        Flush();
+        bool pending = !leading && segment < ownEnd && segmentStop > end;
+        if (usedCoreNum > 1) {
+            PipeBarrier<PIPE_ALL>();
+            SyncAll();
+        }
+        if (pending) {
+            MergeSlots();
+            Stage(segment);
+            Flush();
+        }
+    }
+
+private:
+    // offsets 中第一个不小于 position 的下标
+    __aicore__ inline uint32_t LowerBound(uint32_t position)
+    {
+        uint32_t lo = 0;
+        uint32_t hi = segmentNum;
+        while (lo < hi) {
+            uint32_t mid = lo + (hi - lo) / 2;
+            if (static_cast<uint32_t>(offsetsGlobal.GetValue(mid)) < position) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+
+    // 从 segment 起依次记下空段，停在第一个非空的段
+    __aicore__ inline void OpenSegment()
+    {
+        hasBest = false;
+        while (segment < ownEnd) {
+            segmentStart = static_cast<uint32_t>(offsetsGlobal.GetValue(segment));
+            segmentStop = static_cast<uint32_t>(offsetsGlobal.GetValue(segment + 1));
+            if (segmentStop > segmentStart) {
+                return;
+            }
+            Stage(segment);
+            segment++;
+        }
+    }
+
+    // 当前段在本核内结束：开头那段的部分结果记入槽位，自己的段暂存
+    __aicore__ inline void CloseSegment()
+    {
+        if (leading) {
+            KeepSlot();
+            leading = false;
+        } else {
+            Stage(segment);
+        }
+        segment++;
+        OpenSegment();
+    }
+
+    // 规约块内 [offset, offset + count) 并与当前最优合并。起点须 32B 对齐，
+    // 对齐后多出的前缀已被前面的段用过，置为 -inf 后一并规约
+    __aicore__ inline void ReducePiece(const LocalTensor<T> &xLocal, uint32_t offset, uint32_t count, uint32_t t0)
+    {
+        constexpr uint32_t alignNum = ONE_BLK_SIZE / sizeof(T);
+        uint32_t head = offset % alignNum;
+        uint32_t start = offset - head;
+        if (head != 0) {
+            uint64_t mask[2] = {(static_cast<uint64_t>(1) << head) - 1, 0};
+            if constexpr (sizeof(T) == sizeof(uint16_t)) {
+                Duplicate(xLocal[start].template ReinterpretCast<uint16_t>(), NEG_INF_HALF, mask, 1, 1, 8);
+            } else {
+                Duplicate(xLocal[start].template ReinterpretCast<uint32_t>(), NEG_INF_FLOAT, mask, 1, 1, 8);
+            }
+        }
+        LocalTensor<T> maxLocal = maxBuf.Get<T>();
+        ReduceMax(maxLocal, xLocal[start], workBuf.Get<T>(), head + count, true);
+        WaitPipe<HardEvent::V_S>(&pipe);
+        float value = static_cast<float>(maxLocal.GetValue(0));
+        uint32_t index;
+        if constexpr (sizeof(T) == sizeof(uint16_t)) {
+            index = maxLocal.template ReinterpretCast<uint16_t>().GetValue(1);
+        } else {
+            index = maxLocal.template ReinterpretCast<uint32_t>().GetValue(1);
+        }
+        // 该部分全为 -inf 时可能落在前缀上，取该部分的第一个元素
+        if (index < head) {
+            index = head;
+        }
+        Merge(value, t0 + start + index);
+    }
+
+    __aicore__ inline void Merge(float value, uint32_t position)
+    {
+        if (!hasBest || value > bestValue) {
+            bestValue = value;
+            bestPosition = position;
+            hasBest = true;
+        }
+    }
+
+    // 暂存第 s 段的结果，空段为 -1 与 0；攒满后写回
+    __aicore__ inline void Stage(uint32_t s)
+    {
+        LocalTensor<int32_t> stageIndex = stageBuf.Get<int32_t>();
+        LocalTensor<T> stageValue = stageIndex[STAGE_LENGTH].template ReinterpretCast<T>();
+        stageIndex.SetValue(s - stageStart, hasBest ? static_cast<int32_t>(bestPosition - segmentStart) : -1);
+        stageValue.SetValue(s - stageStart, hasBest ? static_cast<T>(bestValue) : static_cast<T>(0.0f));
+        staged++;
+        if (staged == STAGE_LENGTH) {
+            Flush();
+        }
+    }
+
+    __aicore__ inline void Flush()
+    {
+        if (staged != 0) {
+            LocalTensor<int32_t> stageIndex = stageBuf.Get<int32_t>();
+            LocalTensor<T> stageValue = stageIndex[STAGE_LENGTH].template ReinterpretCast<T>();
+            WaitPipe<HardEvent::S_MTE3>(&pipe);
+            DataCopyExtParams indexParams{1, static_cast<uint32_t>(staged * sizeof(int32_t)), 0, 0, 0};
+            DataCopyPad(indicesGlobal[stageStart], stageIndex, indexParams);
+            DataCopyExtParams valueParams{1, static_cast<uint32_t>(staged * sizeof(T)), 0, 0, 0};
+            DataCopyPad(valuesGlobal[stageStart], stageValue, valueParams);
+            WaitPipe<HardEvent::MTE3_S>(&pipe);
+        }
+        stageStart += staged;
+        staged = 0;
+    }
+
+    __aicore__ inline void KeepSlot()
+    {
+        slotSegment = static_cast<int32_t>(segment);
+        slotPosition = bestPosition;
+        slotValue = bestValue;
+    }
+
+    __aicore__ inline void WriteSlot()
+    {
+        LocalTensor<int32_t> slotLocal = slotBuf.Get<int32_t>();
+        slotLocal.SetValue(0, slotSegment);
+        slotLocal.SetValue(1, static_cast<int32_t>(slotPosition));
+        slotLocal.template ReinterpretCast<float>().SetValue(2, slotValue);
+        WaitPipe<HardEvent::S_MTE3>(&pipe);
+        DataCopy(slotGlobal[blockIdx * SLOT_NUM], slotLocal, SLOT_NUM);
+        WaitPipe<HardEvent::MTE3_S>(&pipe);
+    }
+
+    // 当前段延续到后面的核：按核号顺序合并它们开头那部分的结果
+    __aicore__ inline void MergeSlots()
+    {
+        LocalTensor<int32_t> slotLocal = slotBuf.Get<int32_t>();
+        DataCopy(slotLocal, slotGlobal, usedCoreNum * SLOT_NUM);
+        WaitPipe<HardEvent::MTE2_S>(&pipe);
+        for (uint32_t c = blockIdx + 1; c < usedCoreNum; c++) {
+            if (slotLocal.GetValue(c * SLOT_NUM) != static_cast<int32_t>(segment)) {
+                break;
+            }
+            Merge(slotLocal.template ReinterpretCast<float>().GetValue(c * SLOT_NUM + 2),
+                  static_cast<uint32_t>(slotLocal.GetValue(c * SLOT_NUM + 1)));
+        }
+    }
+
+private:
+    TPipe pipe;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueue;
+    TBuf<QuePosition::VECCALC> workBuf;
+    TBuf<QuePosition::VECCALC> maxBuf;
+    TBuf<QuePosition::VECCALC> stageBuf;
+    TBuf<QuePosition::VECCALC> slotBuf;
+
+    GlobalTensor<T> xGlobal;
+    GlobalTensor<int32_t> offsetsGlobal;
+    GlobalTensor<int32_t> indicesGlobal;
+    GlobalTensor<T> valuesGlobal;
+    GlobalTensor<int32_t> slotGlobal;
+
+    uint32_t totalLength;
+    uint32_t segmentNum;
+    uint32_t tileLength;
+    uint32_t usedCoreNum;
+    uint32_t blockIdx;
+    uint32_t begin;
+    uint32_t end;
+    uint32_t ownEnd;
+    // 当前段及其在 x 中的范围；leading 为该段由前面的核拥有
+    uint32_t segment;
+    uint32_t segmentStart;
+    uint32_t segmentStop;
+    bool leading;
+    bool hasBest;
+    float bestValue;
+    uint32_t bestPosition;
+    // 本核开头那段的部分结果，没有时段号为 NO_SEGMENT
+    int32_t slotSegment;
+    float slotValue;
+    uint32_t slotPosition;
+    uint32_t stageStart;
+    uint32_t staged;
+};
+
+extern "C" __global__ __aicore__ void segment_arg_max_with_value(GM_ADDR x, GM_ADDR offsets, GM_ADDR indices, GM_ADDR values, GM_ADDR workspace, GM_ADDR tiling) {
+    GET_TILING_DATA(tiling_data, tiling);
+    GM_ADDR usrWorkspace = GetUserWorkspace(workspace);
+    KernelSegmentArgMaxWithValue<DTYPE_X> op;
+    op.Init(x, offsets, indices, values, usrWorkspace, tiling_data);
+    op.Process();
+}
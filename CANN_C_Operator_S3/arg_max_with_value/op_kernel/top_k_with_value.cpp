@@ -0,0 +1,489 @@
+#include "reduce_with_index.h"
+
+// 沿一个维度取最优的 k 个值及其索引，按从优到劣排列，值相等时索引小的在前。
+// 沿用 ArgMaxWithValue 的布局与切分，每个 lane 在 UB 中维护有序的 k 个候选，
+// 每来一个候选只做 k 次比较与选择完成插入，一遍扫描输入即得到全部 k 个结果，不必按 k 次 ArgMax 多次读入；
+// SPLIT 布局下各 lane 的候选最后再标量归并
+template <typename T, typename CMP, uint32_t LAYOUT>
+class KernelTopKWithValue {
+public:
+    using CT = typename ComputeType<T>::Type;
+
+    __aicore__ inline KernelTopKWithValue() {}
+
+    // 初始化
+    template <typename TilingData>
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR indices, GM_ADDR values, const TilingData &tilingData)
+    {
+        outer = tilingData.outer;
+        axis = tilingData.axis;
+        inner = tilingData.inner;
+        laneLength = tilingData.lane_length;
+        axisTile = tilingData.axis_tile;
+        k = tilingData.k;
+        groupStart = GetBlockIdx() * tilingData.block_groups;
+        groupCount = tilingData.group_num - groupStart < tilingData.block_groups ? tilingData.group_num - groupStart
+                                                                                : tilingData.block_groups;
+        // 每个掩码单独按 32B 对齐
+        maskStride = CeilDiv(laneLength / 8, ONE_BLK_SIZE) * ONE_BLK_SIZE;
+
+        xGlobal.SetGlobalBuffer((__gm__ T *)x);
+        indicesGlobal.SetGlobalBuffer((__gm__ int32_t *)indices);
+        valuesGlobal.SetGlobalBuffer((__gm__ T *)values);
+
+        if constexpr (LAYOUT == LAYOUT_GATHER) {
+            rowStride = axisTile;
+            pipe.InitBuffer(inQueue, BUFFER_NUM, laneLength * rowStride * sizeof(T));
+            if constexpr (!IsSameType<T, CT>::value) {
+                pipe.InitBuffer(castBuf, laneLength * rowStride * sizeof(CT));
+            }
+            pipe.InitBuffer(offsetBuf, 2 * laneLength * sizeof(int32_t));
+            pipe.InitBuffer(rowBuf, laneLength * sizeof(CT));
+            // 写回前把 [k, lane] 交织为 [lane, k]：float 索引与候选值各一张 gather 偏移表，以及交织结果
+            pipe.InitBuffer(interleaveBuf, 3 * k * laneLength * sizeof(float));
+            LocalTensor<int32_t> table = interleaveBuf.Get<int32_t>();
+            BuildInterleave(table, sizeof(float));
+            if constexpr (sizeof(CT) != sizeof(float)) {
+                BuildInterleave(table[k * laneLength], sizeof(CT));
+            }
+        } else {
+            pipe.InitBuffer(inQueue, BUFFER_NUM, axisTile * laneLength * sizeof(T));
+            if constexpr (!IsSameType<T, CT>::value) {
+                pipe.InitBuffer(rowBuf, laneLength * sizeof(CT));
+            }
+        }
+        if constexpr (LAYOUT == LAYOUT_SPLIT) {
+            // lane 内位置、尾段掩码、归并时各 lane 已取出的个数，以及 half 候选的 float 副本
+            pipe.InitBuffer(splitBuf, laneLength * (3 + k) * sizeof(float));
+        }
+        if constexpr (IsSameType<CT, int32_t>::value) {
+            pipe.InitBuffer(diffBuf, laneLength * (sizeof(int32_t) + sizeof(float)));
+        }
+        pipe.InitBuffer(valueBuf, k * laneLength * sizeof(CT));
+        pipe.InitBuffer(indexBuf, k * laneLength * sizeof(float));
+        pipe.InitBuffer(maskBuf, k * maskStride);
+        pipe.InitBuffer(positionBuf, laneLength * sizeof(float));
+        pipe.InitBuffer(indicesQueue, BUFFER_NUM, k * laneLength * sizeof(int32_t));
+        pipe.InitBuffer(valuesQueue, BUFFER_NUM, k * laneLength * sizeof(T));
+    }
+
+    __aicore__ inline void Process()
+    {
+        if (groupCount == 0) {
+            return;
+        }
+        if constexpr (LAYOUT == LAYOUT_ROW) {
+            ProcessRow();
+        } else if constexpr (LAYOUT == LAYOUT_GATHER) {
+            ProcessGather();
+        } else {
+            ProcessSplit();
+        }
+    }
+
+private:
+    // 一组为某个 outer 下 inner 方向连续的 laneLength 个元素，搬入的每一行即各 lane 的一个候选
+    __aicore__ inline void ProcessRow()
+    {
+        LocalTensor<float> position = positionBuf.Get<float>();
+        uint32_t innerGroups = CeilDiv(inner, laneLength);
+        for (uint32_t g = groupStart; g < groupStart + groupCount; g++) {
+            uint32_t o = g / innerGroups;
+            uint32_t i0 = (g % innerGroups) * laneLength;
+            uint32_t valid = inner - i0 < laneLength ? inner - i0 : laneLength;
+            uint64_t base = static_cast<uint64_t>(o) * axis * inner + i0;
+            uint32_t filled = 0;
+            for (uint32_t j0 = 0; j0 < axis; j0 += axisTile) {
+                uint32_t rows = axis - j0 < axisTile ? axis - j0 : axisTile;
+                LocalTensor<T> xLocal = inQueue.AllocTensor<T>();
+                uint32_t blockLen = valid * sizeof(T);
+                uint32_t dstStride = (laneLength * sizeof(T) - CeilDiv(blockLen, ONE_BLK_SIZE) * ONE_BLK_SIZE) /
+                                     ONE_BLK_SIZE;
+                DataCopyExtParams copyParams{static_cast<uint16_t>(rows), blockLen,
+                                             static_cast<uint32_t>((inner - valid) * sizeof(T)), dstStride, 0};
+                DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+                DataCopyPad(xLocal, xGlobal[base + static_cast<uint64_t>(j0) * inner], copyParams, padParams);
+                inQueue.EnQue(xLocal);
+                xLocal = inQueue.DeQue<T>();
+                for (uint32_t r = 0; r < rows; r++) {
+                    Duplicate(position, static_cast<float>(j0 + r), laneLength);
+                    Insert(ToCompute(xLocal[r * laneLength]), filled, false);
+                    filled += filled < k ? 1 : 0;
+                }
+                inQueue.FreeTensor(xLocal);
+            }
+            EmitRows(static_cast<uint64_t>(o) * k * inner + i0, valid);
+        }
+    }
+
+    // 一组为连续的 laneLength 行，每行搬入一段 axisTile 个元素，按行首偏移逐列 gather 成各 lane 的候选
+    __aicore__ inline void ProcessGather()
+    {
+        LocalTensor<float> position = positionBuf.Get<float>();
+        LocalTensor<int32_t> rowBase = offsetBuf.Get<int32_t>();
+        LocalTensor<int32_t> offset = rowBase[laneLength];
+        ArithProgression<int32_t>(rowBase, 0, static_cast<int32_t>(rowStride * sizeof(CT)), laneLength);
+        for (uint32_t g = groupStart; g < groupStart + groupCount; g++) {
+            uint32_t r0 = g * laneLength;
+            uint32_t valid = outer - r0 < laneLength ? outer - r0 : laneLength;
+            uint64_t base = static_cast<uint64_t>(r0) * axis;
+            uint32_t filled = 0;
+            for (uint32_t j0 = 0; j0 < axis; j0 += axisTile) {
+                uint32_t cols = axis - j0 < axisTile ? axis - j0 : axisTile;
+                LocalTensor<T> xLocal = inQueue.AllocTensor<T>();
+                uint32_t blockLen = cols * sizeof(T);
+                uint32_t dstStride = (rowStride * sizeof(T) - CeilDiv(blockLen, ONE_BLK_SIZE) * ONE_BLK_SIZE) /
+                                     ONE_BLK_SIZE;
+                DataCopyExtParams copyParams{static_cast<uint16_t>(valid), blockLen,
+                                             static_cast<uint32_t>((axis - cols) * sizeof(T)), dstStride, 0};
+                DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+                DataCopyPad(xLocal, xGlobal[base + j0], copyParams, padParams);
+                inQueue.EnQue(xLocal);
+                xLocal = inQueue.DeQue<T>();
+                LocalTensor<CT> tile;
+                if constexpr (IsSameType<T, CT>::value) {
+                    tile = xLocal;
+                } else {
+                    tile = castBuf.Get<CT>();
+                    Cast(tile, xLocal, RoundMode::CAST_NONE, laneLength * rowStride);
+                }
+                LocalTensor<CT> row = rowBuf.Get<CT>();
+                for (uint32_t c = 0; c < cols; c++) {
+                    Adds(offset, rowBase, static_cast<int32_t>(c * sizeof(CT)), laneLength);
+                    Gather(row, tile, offset.ReinterpretCast<uint32_t>(), 0, laneLength);
+                    Duplicate(position, static_cast<float>(j0 + c), laneLength);
+                    Insert(row, filled, false);
+                    filled += filled < k ? 1 : 0;
+                }
+                inQueue.FreeTensor(xLocal);
+            }
+            EmitInterleaved(static_cast<uint64_t>(r0) * k, valid);
+        }
+    }
+
+    // 一组为一行：按 laneLength 切段，lane w 依次看到位置 w, w + laneLength, ... 的元素，各 lane 的候选索引递增；
+    // 尾段不足 laneLength 时越界的 lane 由尾段掩码排除。tiling 保证整段数不少于 8，各 lane 都能填满 k 个候选。
+    // 各行结果暂存在输出缓冲中，每 laneLength 行写回一次
+    __aicore__ inline void ProcessSplit()
+    {
+        LocalTensor<float> lanePos = splitBuf.Get<float>();
+        LocalTensor<float> position = positionBuf.Get<float>();
+        ArithProgression<float>(lanePos, 0.0f, 1.0f, laneLength);
+        uint32_t fullSteps = axis / laneLength;
+        uint32_t stepNum = CeilDiv(axis, laneLength);
+        if (stepNum > fullSteps) {
+            CompareScalar(lanePos[laneLength].template ReinterpretCast<uint8_t>(), lanePos,
+                          static_cast<float>(axis - fullSteps * laneLength), CMPMODE::LT, laneLength);
+        }
+        LocalTensor<int32_t> indicesLocal;
+        LocalTensor<T> valuesLocal;
+        uint32_t staged = 0;
+        for (uint32_t g = groupStart; g < groupStart + groupCount; g++) {
+            uint64_t base = static_cast<uint64_t>(g) * axis;
+            uint32_t filled = 0;
+            for (uint32_t s0 = 0; s0 < stepNum; s0 += axisTile) {
+                uint32_t steps = stepNum - s0 < axisTile ? stepNum - s0 : axisTile;
+                uint32_t start = s0 * laneLength;
+                uint32_t count = axis - start < steps * laneLength ? axis - start : steps * laneLength;
+                LocalTensor<T> xLocal = inQueue.AllocTensor<T>();
+                DataCopyExtParams copyParams{1, static_cast<uint32_t>(count * sizeof(T)), 0, 0, 0};
+                DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+                DataCopyPad(xLocal, xGlobal[base + start], copyParams, padParams);
+                inQueue.EnQue(xLocal);
+                xLocal = inQueue.DeQue<T>();
+                for (uint32_t s = 0; s < steps; s++) {
+                    Adds(position, lanePos, static_cast<float>(start + s * laneLength), laneLength);
+                    Insert(ToCompute(xLocal[s * laneLength]), filled, s0 + s == fullSteps);
+                    filled += filled < k ? 1 : 0;
+                }
+                inQueue.FreeTensor(xLocal);
+            }
+
+            if (staged == 0) {
+                indicesLocal = indicesQueue.AllocTensor<int32_t>();
+                valuesLocal = valuesQueue.AllocTensor<T>();
+            }
+            if constexpr (IsSameType<CT, half>::value) {
+                LocalTensor<float> mergeValue = lanePos[3 * laneLength];
+                Cast(mergeValue, valueBuf.Get<CT>(), RoundMode::CAST_NONE, k * laneLength);
+                MergeLanes(mergeValue, indicesLocal, valuesLocal, staged * k);
+            } else {
+                MergeLanes(valueBuf.Get<CT>(), indicesLocal, valuesLocal, staged * k);
+            }
+            staged++;
+            if (staged == laneLength || g == groupStart + groupCount - 1) {
+                // 结果由标量写入，写回前后都需与 MTE3 同步
+                WaitPipe<HardEvent::S_MTE3>(&pipe);
+                indicesQueue.EnQue(indicesLocal);
+                valuesQueue.EnQue(valuesLocal);
+                indicesLocal = indicesQueue.DeQue<int32_t>();
+                valuesLocal = valuesQueue.DeQue<T>();
+                uint64_t offset = static_cast<uint64_t>(g + 1 - staged) * k;
+                DataCopyExtParams indicesParams{1, static_cast<uint32_t>(staged * k * sizeof(int32_t)), 0, 0, 0};
+                DataCopyPad(indicesGlobal[offset], indicesLocal, indicesParams);
+                DataCopyExtParams valuesParams{1, static_cast<uint32_t>(staged * k * sizeof(T)), 0, 0, 0};
+                DataCopyPad(valuesGlobal[offset], valuesLocal, valuesParams);
+                WaitPipe<HardEvent::MTE3_S>(&pipe);
+                indicesQueue.FreeTensor(indicesLocal);
+                valuesQueue.FreeTensor(valuesLocal);
+                staged = 0;
+            }
+        }
+    }
+
+    // 各 lane 的 k 个候选已从优到劣排列，k 次取出全部 lane 队首中最优的一个(值相等时索引小的优先)，
+    // 结果写到输出缓冲的第 slot 个位置起。key 为标量比较用的值，half 时为其 float 副本
+    template <typename U>
+    __aicore__ inline void MergeLanes(const LocalTensor<U> &key, LocalTensor<int32_t> &indicesLocal,
+                                      LocalTensor<T> &valuesLocal, uint32_t slot)
+    {
+        LocalTensor<CT> value = valueBuf.Get<CT>();
+        LocalTensor<float> index = indexBuf.Get<float>();
+        LocalTensor<int32_t> head = splitBuf.Get<int32_t>()[2 * laneLength];
+        Duplicate(head, 0, laneLength);
+        WaitPipe<HardEvent::V_S>(&pipe);
+        for (uint32_t t = 0; t < k; t++) {
+            uint32_t bestLane = 0;
+            uint32_t bestPos = head.GetValue(0) * laneLength;
+            U bestKey = key.GetValue(bestPos);
+            float bestIndex = index.GetValue(bestPos);
+            for (uint32_t w = 1; w < laneLength; w++) {
+                uint32_t pos = head.GetValue(w) * laneLength + w;
+                U candKey = key.GetValue(pos);
+                float candIndex = index.GetValue(pos);
+                if (CMP::Better(candKey, bestKey) || (candKey == bestKey && candIndex < bestIndex)) {
+                    bestLane = w;
+                    bestPos = pos;
+                    bestKey = candKey;
+                    bestIndex = candIndex;
+                }
+            }
+            head.SetValue(bestLane, head.GetValue(bestLane) + 1);
+            indicesLocal.SetValue(slot + t, static_cast<int32_t>(bestIndex));
+            if constexpr (IsSameType<T, CT>::value) {
+                valuesLocal.SetValue(slot + t, value.GetValue(bestPos));
+            } else {
+                valuesLocal.SetValue(slot + t, static_cast<T>(static_cast<int32_t>(bestKey)));
+            }
+        }
+        // 下一行会以向量指令重写 head
+        WaitPipe<HardEvent::S_V>(&pipe);
+    }
+
+    __aicore__ inline LocalTensor<CT> ToCompute(const LocalTensor<T> &src)
+    {
+        if constexpr (IsSameType<T, CT>::value) {
+            return src;
+        } else {
+            LocalTensor<CT> row = rowBuf.Get<CT>();
+            Cast(row, src, RoundMode::CAST_NONE, laneLength);
+            return row;
+        }
+    }
+
+    // 候选严格优于 current 的掩码；int32 比较取优结果与 current 之差是否非零
+    __aicore__ inline void CompareBetter(const LocalTensor<uint8_t> &mask, const LocalTensor<CT> &row,
+                                         const LocalTensor<CT> &current)
+    {
+        if constexpr (IsSameType<CT, int32_t>::value) {
+            LocalTensor<int32_t> diff = diffBuf.Get<int32_t>();
+            LocalTensor<float> diffFloat = diff[laneLength].template ReinterpretCast<float>();
+            CMP::Reduce(diff, row, current, laneLength);
+            Sub(diff, diff, current, laneLength);
+            Cast(diffFloat, diff, RoundMode::CAST_NONE, laneLength);
+            CompareScalar(mask, diffFloat, 0.0f, CMPMODE::NE, laneLength);
+        } else {
+            Compare(mask, row, current, CMP::BETTER, laneLength);
+        }
+    }
+
+    // dst = mask ? src0 : src1，int32 按位选择，借用 float 的 Select
+    __aicore__ inline void SelectValue(const LocalTensor<CT> &dst, const LocalTensor<uint8_t> &mask,
+                                       const LocalTensor<CT> &src0, const LocalTensor<CT> &src1)
+    {
+        if constexpr (IsSameType<CT, int32_t>::value) {
+            Select(dst.template ReinterpretCast<float>(), mask, src0.template ReinterpretCast<float>(),
+                   src1.template ReinterpretCast<float>(), SELMODE::VSEL_TENSOR_TENSOR_MODE, laneLength);
+        } else {
+            Select(dst, mask, src0, src1, SELMODE::VSEL_TENSOR_TENSOR_MODE, laneLength);
+        }
+    }
+
+    // 插入一个候选，位置取自 positionBuf。先对 k 个当前值求出候选严格更优的掩码，
+    // 由于当前值有序，m[r] 为 1 时其后的掩码也为 1；再自后向前 v[r] = m[r-1] ? v[r-1] : (m[r] ? x : v[r])。
+    // 前 filled 个之后的位置尚未填充，视为最差；tail 为尾段，越界的 lane 不插入
+    __aicore__ inline void Insert(const LocalTensor<CT> &row, uint32_t filled, bool tail)
+    {
+        LocalTensor<CT> value = valueBuf.Get<CT>();
+        LocalTensor<float> index = indexBuf.Get<float>();
+        LocalTensor<uint8_t> mask = maskBuf.Get<uint8_t>();
+        LocalTensor<float> position = positionBuf.Get<float>();
+        uint32_t maskWords = laneLength / 16;
+        for (uint32_t r = 0; r < k; r++) {
+            LocalTensor<uint8_t> m = mask[r * maskStride];
+            if (r >= filled) {
+                Duplicate(m.ReinterpretCast<uint16_t>(), static_cast<uint16_t>(0xFFFF), maskWords);
+            } else {
+                CompareBetter(m, row, value[r * laneLength]);
+            }
+            if constexpr (LAYOUT == LAYOUT_SPLIT) {
+                if (tail) {
+                    LocalTensor<uint16_t> tailMask = splitBuf.Get<uint16_t>()[2 * laneLength];
+                    And(m.ReinterpretCast<uint16_t>(), m.ReinterpretCast<uint16_t>(), tailMask, maskWords);
+                }
+            }
+        }
+        for (uint32_t r = k; r-- > 0;) {
+            LocalTensor<uint8_t> m = mask[r * maskStride];
+            LocalTensor<CT> v = value[r * laneLength];
+            LocalTensor<float> idx = index[r * laneLength];
+            SelectValue(v, m, row, v);
+            Select(idx, m, position, idx, SELMODE::VSEL_TENSOR_TENSOR_MODE, laneLength);
+            if (r > 0) {
+                LocalTensor<uint8_t> prev = mask[(r - 1) * maskStride];
+                SelectValue(v, prev, value[(r - 1) * laneLength], v);
+                Select(idx, prev, index[(r - 1) * laneLength], idx, SELMODE::VSEL_TENSOR_TENSOR_MODE, laneLength);
+            }
+        }
+    }
+
+    // table[n * k + r] = (r * laneLength + n) * elemSize，把 [k, lane] 的第 (r, n) 个元素 gather 到 [lane, k]。
+    // 先标量写出前 8 行，之后每次把已有部分加上行偏移复制一份，行数翻倍
+    __aicore__ inline void BuildInterleave(const LocalTensor<int32_t> &table, uint32_t elemSize)
+    {
+        constexpr uint32_t SEED_ROWS = 8;
+        for (uint32_t n = 0; n < SEED_ROWS; n++) {
+            for (uint32_t r = 0; r < k; r++) {
+                table.SetValue(n * k + r, static_cast<int32_t>((r * laneLength + n) * elemSize));
+            }
+        }
+        WaitPipe<HardEvent::S_V>(&pipe);
+        for (uint32_t m = SEED_ROWS; m < laneLength; m *= 2) {
+            uint32_t rows = laneLength - m < m ? laneLength - m : m;
+            Adds(table[m * k], table, static_cast<int32_t>(m * elemSize), rows * k);
+        }
+    }
+
+    __aicore__ inline void ToOutput(const LocalTensor<T> &dst, const LocalTensor<CT> &src)
+    {
+        if constexpr (IsSameType<T, CT>::value) {
+            DataCopy(dst, src, k * laneLength);
+        } else {
+            Cast(dst, src, RoundMode::CAST_NONE, k * laneLength);
+        }
+    }
+
+    // [k, lane] 的结果按 k 行写回，GM 中相邻两行相隔 inner 个元素
+    __aicore__ inline void EmitRows(uint64_t offset, uint32_t valid)
+    {
+        LocalTensor<int32_t> indicesLocal = indicesQueue.AllocTensor<int32_t>();
+        Cast(indicesLocal, indexBuf.Get<float>(), RoundMode::CAST_RINT, k * laneLength);
+        indicesQueue.EnQue(indicesLocal);
+        LocalTensor<T> valuesLocal = valuesQueue.AllocTensor<T>();
+        ToOutput(valuesLocal, valueBuf.Get<CT>());
+        valuesQueue.EnQue(valuesLocal);
+
+        indicesLocal = indicesQueue.DeQue<int32_t>();
+        CopyOutRows(indicesGlobal[offset], indicesLocal, valid);
+        indicesQueue.FreeTensor(indicesLocal);
+        valuesLocal = valuesQueue.DeQue<T>();
+        CopyOutRows(valuesGlobal[offset], valuesLocal, valid);
+        valuesQueue.FreeTensor(valuesLocal);
+    }
+
+    template <typename U>
+    __aicore__ inline void CopyOutRows(const GlobalTensor<U> &dst, const LocalTensor<U> &src, uint32_t valid)
+    {
+        uint32_t blockLen = valid * sizeof(U);
+        uint32_t srcStride = (laneLength * sizeof(U) - CeilDiv(blockLen, ONE_BLK_SIZE) * ONE_BLK_SIZE) / ONE_BLK_SIZE;
+        DataCopyExtParams copyParams{static_cast<uint16_t>(k), blockLen, srcStride,
+                                     static_cast<uint32_t>((inner - valid) * sizeof(U)), 0};
+        DataCopyPad(dst, src, copyParams);
+    }
+
+    // [k, lane] 的结果交织为 [lane, k] 后连续写回 valid 行
+    __aicore__ inline void EmitInterleaved(uint64_t offset, uint32_t valid)
+    {
+        uint32_t total = k * laneLength;
+        LocalTensor<int32_t> table = interleaveBuf.Get<int32_t>();
+        LocalTensor<uint32_t> indexTable = table.ReinterpretCast<uint32_t>();
+        LocalTensor<uint32_t> valueTable = sizeof(CT) == sizeof(float) ? indexTable : indexTable[total];
+        LocalTensor<float> gathered = interleaveBuf.Get<float>()[2 * total];
+
+        LocalTensor<int32_t> indicesLocal = indicesQueue.AllocTensor<int32_t>();
+        Gather(gathered, indexBuf.Get<float>(), indexTable, 0, total);
+        Cast(indicesLocal, gathered, RoundMode::CAST_RINT, total);
+        indicesQueue.EnQue(indicesLocal);
+        LocalTensor<T> valuesLocal = valuesQueue.AllocTensor<T>();
+        LocalTensor<CT> gatheredValue = gathered.ReinterpretCast<CT>();
+        Gather(gatheredValue, valueBuf.Get<CT>(), valueTable, 0, total);
+        ToOutput(valuesLocal, gatheredValue);
+        valuesQueue.EnQue(valuesLocal);
+
+        indicesLocal = indicesQueue.DeQue<int32_t>();
+        DataCopyExtParams indicesParams{1, static_cast<uint32_t>(valid * k * sizeof(int32_t)), 0, 0, 0};
+        DataCopyPad(indicesGlobal[offset], indicesLocal, indicesParams);
+        indicesQueue.FreeTensor(indicesLocal);
+        valuesLocal = valuesQueue.DeQue<T>();
+        DataCopyExtParams valuesParams{1, static_cast<uint32_t>(valid * k * sizeof(T)), 0, 0, 0};
+        DataCopyPad(valuesGlobal[offset], valuesLocal, valuesParams);
+        valuesQueue.FreeTensor(valuesLocal);
+    }
+
+private:
+    TPipe pipe;
+    TQue<QuePosition::VECIN, BUFFER_NUM> inQueue;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> indicesQueue;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> valuesQueue;
+    TBuf<QuePosition::VECCALC> castBuf;
+    TBuf<QuePosition::VECCALC> offsetBuf;
+    TBuf<QuePosition::VECCALC> rowBuf;
+    TBuf<QuePosition::VECCALC> interleaveBuf;
+    TBuf<QuePosition::VECCALC> splitBuf;
+    TBuf<QuePosition::VECCALC> diffBuf;
+    TBuf<QuePosition::VECCALC> valueBuf;
+    TBuf<QuePosition::VECCALC> indexBuf;
+    TBuf<QuePosition::VECCALC> maskBuf;
+    TBuf<QuePosition::VECCALC> positionBuf;
+
+    GlobalTensor<T> xGlobal;
+    GlobalTensor<int32_t> indicesGlobal;
+    GlobalTensor<T> valuesGlobal;
+
+    uint32_t outer;
+    uint32_t axis;
+    uint32_t inner;
+    uint32_t laneLength;
+    uint32_t axisTile;
+    uint32_t k;
+    uint32_t maskStride;
+    uint32_t rowStride;
+    uint32_t groupStart;
+    uint32_t groupCount;
+};
+
+template <typename CMP, uint32_t LAYOUT, typename TilingData>
+__aicore__ inline void RunTopK(GM_ADDR x, GM_ADDR indices, GM_ADDR values, const TilingData &tilingData)
+{
+    KernelTopKWithValue<DTYPE_X, CMP, LAYOUT> op;
+    op.Init(x, indices, values, tilingData);
+    op.Process();
+}
+
+// tiling key = 布局 + 10 * 取最小的 k 个
+extern "C" __global__ __aicore__ void top_k_with_value(GM_ADDR x, GM_ADDR indices, GM_ADDR values, GM_ADDR workspace, GM_ADDR tiling) {
+    GET_TILING_DATA(tiling_data, tiling);
+    if (TILING_KEY_IS(1)) {
+        RunTopK<MaxCompare, LAYOUT_ROW>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(2)) {
+        RunTopK<MaxCompare, LAYOUT_GATHER>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(3)) {
+        RunTopK<MaxCompare, LAYOUT_SPLIT>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(11)) {
+        RunTopK<MinCompare, LAYOUT_ROW>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(12)) {
+        RunTopK<MinCompare, LAYOUT_GATHER>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(13)) {
+        RunTopK<MinCompare, LAYOUT_SPLIT>(x, indices, values, tiling_data);
+    }
+}
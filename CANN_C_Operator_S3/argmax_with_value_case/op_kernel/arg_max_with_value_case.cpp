@@ -1,53 +1,77 @@
-#include "kernel_operator.h"
-
-// 简化版ArgMax运算的核心计算部分
-template <typename T>
-class KernelArgMaxWithValue {
-public:
-    __aicore__ inline KernelArgMaxWithValue() {}
-
-    // 初始化
-    __aicore__ inline void Init(GM_ADDR inputGM, GM_ADDR outputIndiceGM, GM_ADDR outputValuesGM, uint32_t len) {
-        // 设置数据总长度
-        total_length = len;
-        // 设置输入和输出全局内存
-        srcGlobal.SetGlobalBuffer((__gm__ T *)(inputGM), total_length);
-        dstIndiceGlobal.SetGlobalBuffer((__gm__ int32_t *)(outputIndiceGM), total_length);
-        dstValuesGlobal.SetGlobalBuffer((__gm__ T *)(outputValuesGM), total_length);
-    }
-
-    // 计算过程
-    __aicore__ inline void Process() {
-        // 这里我们使用简单的 for 循环来计算
-        T maxValue = srcGlobal[0];    // 初始值为第一个元素
-        int32_t maxIndex = 0;         // 初始索引为 0
-
-        // 遍历输入数据，找到最大值及其索引
-        for (int32_t i = 1; i < total_length; ++i) {
-            if (srcGlobal[i] > maxValue) {
-                maxValue = srcGlobal[i];
-                maxIndex = i;
-            }
-        }
-
-        // 将计算结果存储到输出数据
-        dstValuesGlobal[0] = maxValue;
-        dstIndiceGlobal[0] = maxIndex;
-    }
-
-private:
-    AscendC::GlobalTensor<T> srcGlobal;          // 输入数据
-    AscendC::GlobalTensor<T> dstValuesGlobal;    // 输出最大值
-    AscendC::GlobalTensor<int32_t> dstIndiceGlobal; // 输出最大值对应的索引
-
-    uint32_t total_length;  // 数据总长度
-};
+// reduce_with_index.h 由工程的 CMakeLists.txt 在配置时从 arg_max_with_value 工程拷入
+#include "reduce_with_index.h"
 
+template <bool LAST_INDEX, uint32_t LAYOUT, uint32_t OUTPUT, typename IDX = int32_t, typename TilingData>
+__aicore__ inline void RunArgMax(GM_ADDR x, GM_ADDR indices, GM_ADDR values, const TilingData &tilingData)
+{
+    KernelReduceWithIndex<DTYPE_X, MaxCompare, LAST_INDEX, LAYOUT, OUTPUT, IDX> op;
+    op.Init(x, indices, values, tilingData);
+    op.Process();
+}
 
+// tiling key = 布局 + 10 * select_last_index + 100 * 省略的输出(1 不写 values，2 不写 indices)
+// + 1000 * indices 为 int64
 extern "C" __global__ __aicore__ void arg_max_with_value_case(GM_ADDR x, GM_ADDR indices, GM_ADDR values, GM_ADDR workspace, GM_ADDR tiling) {
     GET_TILING_DATA(tiling_data, tiling);
-    // TODO: user kernel impl
-    KernelArgMaxWithValue<DTYPE_X> op;
-    op.Init(x, indices, values, tiling_data.size);
-    op.Process();
-}
\ No newline at end of file
+    if (TILING_KEY_IS(1)) {
+        RunArgMax<false, LAYOUT_ROW, OUTPUT_BOTH>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(2)) {
+        RunArgMax<false, LAYOUT_GATHER, OUTPUT_BOTH>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(3)) {
+        RunArgMax<false, LAYOUT_SPLIT, OUTPUT_BOTH>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(11)) {
+        RunArgMax<true, LAYOUT_ROW, OUTPUT_BOTH>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(12)) {
+        RunArgMax<true, LAYOUT_GATHER, OUTPUT_BOTH>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(13)) {
+        RunArgMax<true, LAYOUT_SPLIT, OUTPUT_BOTH>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(101)) {
+        RunArgMax<false, LAYOUT_ROW, OUTPUT_INDICES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(102)) {
+        RunArgMax<false, LAYOUT_GATHER, OUTPUT_INDICES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(103)) {
+        RunArgMax<false, LAYOUT_SPLIT, OUTPUT_INDICES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(111)) {
+        RunArgMax<true, LAYOUT_ROW, OUTPUT_INDICES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(112)) {
+        RunArgMax<true, LAYOUT_GATHER, OUTPUT_INDICES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(113)) {
+        RunArgMax<true, LAYOUT_SPLIT, OUTPUT_INDICES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(201)) {
+        RunArgMax<false, LAYOUT_ROW, OUTPUT_VALUES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(202)) {
+        RunArgMax<false, LAYOUT_GATHER, OUTPUT_VALUES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(203)) {
+        RunArgMax<false, LAYOUT_SPLIT, OUTPUT_VALUES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(211)) {
+        RunArgMax<true, LAYOUT_ROW, OUTPUT_VALUES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(212)) {
+        RunArgMax<true, LAYOUT_GATHER, OUTPUT_VALUES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(213)) {
+        RunArgMax<true, LAYOUT_SPLIT, OUTPUT_VALUES>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1001)) {
+        RunArgMax<false, LAYOUT_ROW, OUTPUT_BOTH, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1002)) {
+        RunArgMax<false, LAYOUT_GATHER, OUTPUT_BOTH, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1003)) {
+        RunArgMax<false, LAYOUT_SPLIT, OUTPUT_BOTH, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1011)) {
+        RunArgMax<true, LAYOUT_ROW, OUTPUT_BOTH, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1012)) {
+        RunArgMax<true, LAYOUT_GATHER, OUTPUT_BOTH, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1013)) {
+        RunArgMax<true, LAYOUT_SPLIT, OUTPUT_BOTH, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1101)) {
+        RunArgMax<false, LAYOUT_ROW, OUTPUT_INDICES, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1102)) {
+        RunArgMax<false, LAYOUT_GATHER, OUTPUT_INDICES, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1103)) {
+        RunArgMax<false, LAYOUT_SPLIT, OUTPUT_INDICES, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1111)) {
+        RunArgMax<true, LAYOUT_ROW, OUTPUT_INDICES, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1112)) {
+        RunArgMax<true, LAYOUT_GATHER, OUTPUT_INDICES, int64_t>(x, indices, values, tiling_data);
+    } else if (TILING_KEY_IS(1113)) {
+        RunArgMax<true, LAYOUT_SPLIT, OUTPUT_INDICES, int64_t>(x, indices, values, tiling_data);
+    }
+}
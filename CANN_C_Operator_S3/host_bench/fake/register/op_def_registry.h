@@ -0,0 +1,650 @@
+#ifndef HOST_BENCH_FAKE_OP_DEF_REGISTRY_H
+#define HOST_BENCH_FAKE_OP_DEF_REGISTRY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <map>
+#include <string>
+#include <vector>
+
+// 只在 host 侧基准中使用：按 op_host 代码用到的接口实现 ge / gert / ops 的最小替身，
+// 不依赖 CANN 即可编译并调用各算子的 TilingFunc 与 InferShape
+namespace fe {
+class PlatFormInfos;
+}
+
+namespace ge {
+using graphStatus = uint32_t;
+constexpr graphStatus GRAPH_SUCCESS = 0;
+constexpr graphStatus GRAPH_FAILED = 0xFFFFFFFF;
+
+// 取值与 CANN 的 ge::DataType / ge::Format 一致
+enum DataType {
+    DT_FLOAT = 0,
+    DT_FLOAT16 = 1,
+    DT_INT8 = 2,
+    DT_INT32 = 3,
+    DT_UINT8 = 4,
+    DT_INT16 = 6,
+    DT_UINT16 = 7,
+    DT_UINT32 = 8,
+    DT_INT64 = 9,
+    DT_UINT64 = 10,
+    DT_DOUBLE = 11,
+    DT_BOOL = 12,
+    DT_BF16 = 27,
+    DT_UNDEFINED = 28,
+};
+
+enum Format {
+    FORMAT_NCHW = 0,
+    FORMAT_NHWC = 1,
+    FORMAT_ND = 2,
+    FORMAT_FRACTAL_NZ = 29,
+};
+
+inline int32_t GetPrimaryFormat(int32_t format)
+{
+    return format & 0xff;
+}
+}
+
+namespace gert {
+class Shape {
+public:
+    static constexpr size_t kMaxDimNum = 8;
+
+    Shape() : dim_num_(0) {}
+    Shape(std::initializer_list<int64_t> dims) : dim_num_(0)
+    {
+        for (int64_t dim : dims) {
+            AppendDim(dim);
+        }
+    }
+
+    size_t GetDimNum() const
+    {
+        return dim_num_;
+    }
+    void SetDimNum(size_t dim_num)
+    {
+        dim_num_ = dim_num;
+    }
+    int64_t GetDim(size_t index) const
+    {
+        return index < dim_num_ ? dims_[index] : 0;
+    }
+    void SetDim(size_t index, int64_t dim)
+    {
+        if (index < kMaxDimNum) {
+            dims_[index] = dim;
+        }
+    }
+    Shape &AppendDim(int64_t dim)
+    {
+        if (dim_num_ < kMaxDimNum) {
+            dims_[dim_num_++] = dim;
+        }
+        return *this;
+    }
+    int64_t GetShapeSize() const
+    {
+        int64_t size = 1;
+        for (size_t i = 0; i < dim_num_; i++) {
+            size *= dims_[i];
+        }
+        return size;
+    }
+
+private:
+    int64_t dims_[kMaxDimNum] = {};
+    size_t dim_num_;
+};
+
+class StorageShape {
+public:
+    StorageShape() {}
+    StorageShape(const Shape &origin, const Shape &storage) : origin_(origin), storage_(storage) {}
+
+    const Shape &GetOriginShape() const
+    {
+        return origin_;
+    }
+    const Shape &GetStorageShape() const
+    {
+        return storage_;
+    }
+    Shape &MutableOriginShape()
+    {
+        return origin_;
+    }
+    Shape &MutableStorageShape()
+    {
+        return storage_;
+    }
+
+private:
+    Shape origin_;
+    Shape storage_;
+};
+
+class CompileTimeTensorDesc {
+public:
+    CompileTimeTensorDesc() : data_type_(ge::DT_FLOAT), origin_format_(ge::FORMAT_ND), storage_format_(ge::FORMAT_ND) {}
+    CompileTimeTensorDesc(ge::DataType data_type, ge::Format format)
+        : data_type_(data_type), origin_format_(format), storage_format_(format)
+    {
+    }
+    CompileTimeTensorDesc(ge::DataType data_type, ge::Format origin_format, ge::Format storage_format)
+        : data_type_(data_type), origin_format_(origin_format), storage_format_(storage_format)
+    {
+    }
+
+    ge::DataType GetDataType() const
+    {
+        return data_type_;
+    }
+    ge::Format GetOriginFormat() const
+    {
+        return origin_format_;
+    }
+    ge::Format GetStorageFormat() const
+    {
+        return storage_format_;
+    }
+
+private:
+    ge::DataType data_type_;
+    ge::Format origin_format_;
+    ge::Format storage_format_;
+};
+
+// 列表属性：元素数后紧跟各元素
+class ContinuousVector {
+public:
+    size_t GetSize() const
+    {
+        return size_;
+    }
+    size_t GetCapacity() const
+    {
+        return capacity_;
+    }
+    const void *GetData() const
+    {
+        return this + 1;
+    }
+
+private:
+    size_t capacity_;
+    size_t size_;
+};
+
+// 各属性按其类型原样存放，字符串含结尾的 '\0'，列表按 ContinuousVector 的布局存放
+class RuntimeAttrs {
+public:
+    template <typename T>
+    const T *GetAttrPointer(size_t index) const
+    {
+        return index < values_.size() ? reinterpret_cast<const T *>(values_[index].data()) : nullptr;
+    }
+    size_t GetAttrNum() const
+    {
+        return values_.size();
+    }
+
+    RuntimeAttrs &Int(int64_t value)
+    {
+        return Append(&value, sizeof(value));
+    }
+    RuntimeAttrs &Bool(bool value)
+    {
+        return Append(&value, sizeof(value));
+    }
+    RuntimeAttrs &Float(float value)
+    {
+        return Append(&value, sizeof(value));
+    }
+    RuntimeAttrs &Str(const char *value)
+    {
+        return Append(value, strlen(value) + 1);
+    }
+    RuntimeAttrs &ListInt(const std::vector<int64_t> &value)
+    {
+        std::vector<uint64_t> data(2 + value.size());
+        data[0] = value.size();
+        data[1] = value.size();
+        memcpy(data.data() + 2, value.data(), value.size() * sizeof(int64_t));
+        return Append(data.data(), data.size() * sizeof(uint64_t));
+    }
+
+private:
+    RuntimeAttrs &Append(const void *data, size_t size)
+    {
+        // 按 8 字节对齐存放，取指针时满足各类型的对齐
+        std::vector<uint64_t> value((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+        memcpy(value.data(), data, size);
+        values_.push_back(value);
+        return *this;
+    }
+
+    std::vector<std::vector<uint64_t>> values_;
+};
+
+class TilingData {
+public:
+    explicit TilingData(size_t capacity) : buffer_(capacity), data_size_(0) {}
+
+    void *GetData()
+    {
+        return buffer_.data();
+    }
+    size_t GetCapacity() const
+    {
+        return buffer_.size();
+    }
+    size_t GetDataSize() const
+    {
+        return data_size_;
+    }
+    void SetDataSize(size_t size)
+    {
+        data_size_ = size;
+    }
+
+private:
+    std::vector<uint8_t> buffer_;
+    size_t data_size_;
+};
+
+// 算子的输入、输出与属性，未连接的可选输入输出记为不存在
+struct NodeDesc {
+    std::string type;
+    std::vector<StorageShape> input_shapes;
+    std::vector<CompileTimeTensorDesc> input_descs;
+    std::vector<bool> input_present;
+    std::vector<bool> output_present;
+    std::vector<CompileTimeTensorDesc> output_descs;
+    RuntimeAttrs attrs;
+
+    NodeDesc &Input(const Shape &shape, ge::DataType data_type, ge::Format format = ge::FORMAT_ND)
+    {
+        input_shapes.push_back(StorageShape(shape, shape));
+        input_descs.push_back(CompileTimeTensorDesc(data_type, format));
+        input_present.push_back(true);
+        return *this;
+    }
+    // 存放格式与原始格式不同(如 FRACTAL_NZ)的输入，分别给出原始(ND)形状与存放形状
+    NodeDesc &Input(const Shape &origin, const Shape &storage, ge::DataType data_type, ge::Format storage_format)
+    {
+        input_shapes.push_back(StorageShape(origin, storage));
+        input_descs.push_back(CompileTimeTensorDesc(data_type, ge::FORMAT_ND, storage_format));
+        input_present.push_back(true);
+        return *this;
+    }
+    NodeDesc &AbsentInput()
+    {
+        input_shapes.push_back(StorageShape());
+        input_descs.push_back(CompileTimeTensorDesc());
+        input_present.push_back(false);
+        return *this;
+    }
+    // tiling 要读取的输出类型(如 indices，须与属性 output_type 一致)在此指定，其余由 InferDataType 推导
+    NodeDesc &Output(bool present = true, ge::DataType data_type = ge::DT_UNDEFINED)
+    {
+        output_present.push_back(present);
+        output_descs.push_back(CompileTimeTensorDesc(data_type, ge::FORMAT_ND));
+        return *this;
+    }
+};
+
+class TilingContext {
+public:
+    static constexpr size_t kTilingCapacity = 64 * 1024;
+    static constexpr size_t kMaxWorkspaceNum = 16;
+
+    TilingContext(const NodeDesc &node, fe::PlatFormInfos *platform)
+        : node_(node), platform_(platform), raw_tiling_(kTilingCapacity), workspace_(kMaxWorkspaceNum, 0),
+          output_shape_(node.output_present.size()), tiling_key_(0), block_dim_(0), deterministic_(0)
+    {
+    }
+
+    const char *GetNodeType() const
+    {
+        return node_.type.c_str();
+    }
+    size_t GetComputeNodeInputNum() const
+    {
+        return node_.input_shapes.size();
+    }
+    size_t GetComputeNodeOutputNum() const
+    {
+        return node_.output_present.size();
+    }
+    const StorageShape *GetInputShape(size_t index) const
+    {
+        return index < node_.input_shapes.size() && node_.input_present[index] ? &node_.input_shapes[index] : nullptr;
+    }
+    const StorageShape *GetOptionalInputShape(size_t index) const
+    {
+        return GetInputShape(index);
+    }
+    const CompileTimeTensorDesc *GetInputDesc(size_t index) const
+    {
+        return index < node_.input_descs.size() && node_.input_present[index] ? &node_.input_descs[index] : nullptr;
+    }
+    const CompileTimeTensorDesc *GetOptionalInputDesc(size_t index) const
+    {
+        return GetInputDesc(index);
+    }
+    const StorageShape *GetOutputShape(size_t index) const
+    {
+        return index < output_shape_.size() && node_.output_present[index] ? &output_shape_[index] : nullptr;
+    }
+    const CompileTimeTensorDesc *GetOutputDesc(size_t index) const
+    {
+        return index < node_.output_descs.size() ? &node_.output_descs[index] : nullptr;
+    }
+    const RuntimeAttrs *GetAttrs() const
+    {
+        return &node_.attrs;
+    }
+    fe::PlatFormInfos *GetPlatformInfo() const
+    {
+        return platform_;
+    }
+    int32_t GetDeterministic() const
+    {
+        return deterministic_;
+    }
+    void SetDeterministic(int32_t deterministic)
+    {
+        deterministic_ = deterministic;
+    }
+
+    TilingData *GetRawTilingData()
+    {
+        return &raw_tiling_;
+    }
+    size_t *GetWorkspaceSizes(size_t num)
+    {
+        return num <= workspace_.size() ? workspace_.data() : nullptr;
+    }
+    ge::graphStatus SetTilingKey(uint64_t tiling_key)
+    {
+        tiling_key_ = tiling_key;
+        return ge::GRAPH_SUCCESS;
+    }
+    uint64_t GetTilingKey() const
+    {
+        return tiling_key_;
+    }
+    ge::graphStatus SetBlockDim(uint32_t block_dim)
+    {
+        block_dim_ = block_dim;
+        return ge::GRAPH_SUCCESS;
+    }
+    uint32_t GetBlockDim() const
+    {
+        return block_dim_;
+    }
+
+private:
+    const NodeDesc &node_;
+    fe::PlatFormInfos *platform_;
+    TilingData raw_tiling_;
+    std::vector<size_t> workspace_;
+    std::vector<StorageShape> output_shape_;
+    uint64_t tiling_key_;
+    uint32_t block_dim_;
+    int32_t deterministic_;
+};
+
+class InferShapeContext {
+public:
+    explicit InferShapeContext(const NodeDesc &node) : node_(node), output_shapes_(node.output_present.size()) {}
+
+    const Shape *GetInputShape(size_t index) const
+    {
+        return index < node_.input_shapes.size() && node_.input_present[index]
+                   ? &node_.input_shapes[index].GetOriginShape()
+                   : nullptr;
+    }
+    const Shape *GetOptionalInputShape(size_t index) const
+    {
+        return GetInputShape(index);
+    }
+    Shape *GetOutputShape(size_t index)
+    {
+        return index < output_shapes_.size() && node_.output_present[index] ? &output_shapes_[index] : nullptr;
+    }
+    const RuntimeAttrs *GetAttrs() const
+    {
+        return &node_.attrs;
+    }
+
+private:
+    const NodeDesc &node_;
+    std::vector<Shape> output_shapes_;
+};
+
+class InferDataTypeContext {
+public:
+    explicit InferDataTypeContext(const NodeDesc &node)
+        : node_(node), output_types_(node.output_descs.size())
+    {
+        for (size_t i = 0; i < output_types_.size(); i++) {
+            output_types_[i] = node.output_descs[i].GetDataType();
+        }
+    }
+
+    ge::DataType GetInputDataType(size_t index) const
+    {
+        return index < node_.input_descs.size() ? node_.input_descs[index].GetDataType() : ge::DT_UNDEFINED;
+    }
+    ge::graphStatus SetOutputDataType(size_t index, ge::DataType data_type)
+    {
+        if (index >= output_types_.size()) {
+            return ge::GRAPH_FAILED;
+        }
+        output_types_[index] = data_type;
+        return ge::GRAPH_SUCCESS;
+    }
+    ge::DataType GetOutputDataType(size_t index) const
+    {
+        return index < output_types_.size() ? output_types_[index] : ge::DT_UNDEFINED;
+    }
+    const RuntimeAttrs *GetAttrs() const
+    {
+        return &node_.attrs;
+    }
+
+private:
+    const NodeDesc &node_;
+    std::vector<ge::DataType> output_types_;
+};
+}
+
+namespace ops {
+enum Option {
+    IGNORE = 0,
+    OPTIONAL = 1,
+    REQUIRED = 2,
+    DYNAMIC = 3,
+};
+
+using TilingKernelFunc = ge::graphStatus (*)(gert::TilingContext *);
+using InferShapeKernelFunc = ge::graphStatus (*)(gert::InferShapeContext *);
+using InferDataTypeKernelFunc = ge::graphStatus (*)(gert::InferDataTypeContext *);
+
+// 只记录声明，基准不校验输入输出的类型组合
+class OpParamDef {
+public:
+    OpParamDef &ParamType(Option)
+    {
+        return *this;
+    }
+    OpParamDef &DataType(std::vector<ge::DataType>)
+    {
+        return *this;
+    }
+    OpParamDef &Format(std::vector<ge::Format>)
+    {
+        return *this;
+    }
+    OpParamDef &UnknownShapeFormat(std::vector<ge::Format>)
+    {
+        return *this;
+    }
+};
+
+class OpAttrDef {
+public:
+    OpAttrDef &AttrType(Option)
+    {
+        return *this;
+    }
+    OpAttrDef &Int()
+    {
+        return *this;
+    }
+    OpAttrDef &Int(int64_t)
+    {
+        return *this;
+    }
+    OpAttrDef &Bool()
+    {
+        return *this;
+    }
+    OpAttrDef &Bool(bool)
+    {
+        return *this;
+    }
+    OpAttrDef &Float(float)
+    {
+        return *this;
+    }
+    OpAttrDef &String(const char *)
+    {
+        return *this;
+    }
+    OpAttrDef &ListInt(std::vector<int64_t>)
+    {
+        return *this;
+    }
+};
+
+class OpAICoreDef {
+public:
+    OpAICoreDef() : tiling_(nullptr) {}
+
+    OpAICoreDef &SetTiling(TilingKernelFunc func)
+    {
+        tiling_ = func;
+        return *this;
+    }
+    OpAICoreDef &AddConfig(const char *)
+    {
+        return *this;
+    }
+    TilingKernelFunc GetTiling() const
+    {
+        return tiling_;
+    }
+
+private:
+    TilingKernelFunc tiling_;
+};
+
+class OpDef {
+public:
+    explicit OpDef(const char *type) : type_(type), infer_shape_(nullptr), infer_data_type_(nullptr) {}
+    virtual ~OpDef() {}
+
+    OpParamDef &Input(const char *name)
+    {
+        return inputs_[name];
+    }
+    OpParamDef &Output(const char *name)
+    {
+        return outputs_[name];
+    }
+    OpAttrDef &Attr(const char *name)
+    {
+        return attrs_[name];
+    }
+    OpDef &SetInferShape(InferShapeKernelFunc func)
+    {
+        infer_shape_ = func;
+        return *this;
+    }
+    OpDef &SetInferDataType(InferDataTypeKernelFunc func)
+    {
+        infer_data_type_ = func;
+        return *this;
+    }
+    OpAICoreDef &AICore()
+    {
+        return aicore_;
+    }
+
+    const std::string &GetType() const
+    {
+        return type_;
+    }
+    InferShapeKernelFunc GetInferShape() const
+    {
+        return infer_shape_;
+    }
+    InferDataTypeKernelFunc GetInferDataType() const
+    {
+        return infer_data_type_;
+    }
+
+private:
+    std::string type_;
+    std::map<std::string, OpParamDef> inputs_;
+    std::map<std::string, OpParamDef> outputs_;
+    std::map<std::string, OpAttrDef> attrs_;
+    InferShapeKernelFunc infer_shape_;
+    InferDataTypeKernelFunc infer_data_type_;
+    OpAICoreDef aicore_;
+};
+
+// OP_ADD 在静态初始化时登记各算子的构造函数
+class OpDefRegistry {
+public:
+    using Creator = OpDef *(*)(const char *);
+
+    static std::map<std::string, Creator> &Creators()
+    {
+        static std::map<std::string, Creator> creators;
+        return creators;
+    }
+    // 未登记时返回 nullptr，调用方负责释放
+    static OpDef *Create(const char *type)
+    {
+        auto it = Creators().find(type);
+        return it == Creators().end() ? nullptr : it->second(type);
+    }
+};
+
+class OpDefRegisterer {
+public:
+    OpDefRegisterer(const char *type, OpDefRegistry::Creator creator)
+    {
+        OpDefRegistry::Creators()[type] = creator;
+    }
+};
+}
+
+#define OP_ADD(opType)                                                                                                 \
+    static ::ops::OpDef *Create##opType(const char *name)                                                             \
+    {                                                                                                                  \
+        return new opType(name);                                                                                       \
+    }                                                                                                                  \
+    static ::ops::OpDefRegisterer g_##opType##_registerer(#opType, Create##opType)
+
+#endif // HOST_BENCH_FAKE_OP_DEF_REGISTRY_H
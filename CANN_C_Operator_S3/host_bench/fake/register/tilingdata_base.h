@@ -0,0 +1,37 @@
+#ifndef HOST_BENCH_FAKE_TILINGDATA_BASE_H
+#define HOST_BENCH_FAKE_TILINGDATA_BASE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// tiling 数据类的替身：各字段按声明顺序放在一个普通类中，整体按字节序列化
+#define BEGIN_TILING_DATA_DEF(class_name)                                                                              \
+    class class_name {                                                                                                 \
+    public:                                                                                                            \
+        size_t GetDataSize() const                                                                                     \
+        {                                                                                                              \
+            return sizeof(*this);                                                                                      \
+        }                                                                                                              \
+        void SaveToBuffer(void *buffer, size_t capacity) const                                                         \
+        {                                                                                                              \
+            memcpy(buffer, this, sizeof(*this) < capacity ? sizeof(*this) : capacity);                                 \
+        }
+
+#define TILING_DATA_FIELD_DEF(type, name)                                                                              \
+    public:                                                                                                            \
+        void set_##name(type value)                                                                                    \
+        {                                                                                                              \
+            name = value;                                                                                              \
+        }                                                                                                              \
+        type get_##name() const                                                                                        \
+        {                                                                                                              \
+            return name;                                                                                               \
+        }                                                                                                              \
+        type name = 0;
+
+#define END_TILING_DATA_DEF }
+
+#define REGISTER_TILING_DATA_CLASS(op_type, class_name)
+
+#endif // HOST_BENCH_FAKE_TILINGDATA_BASE_H
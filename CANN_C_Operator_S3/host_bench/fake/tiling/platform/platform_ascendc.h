@@ -0,0 +1,77 @@
+#ifndef HOST_BENCH_FAKE_PLATFORM_ASCENDC_H
+#define HOST_BENCH_FAKE_PLATFORM_ASCENDC_H
+
+#include <cstdint>
+
+// 平台信息的替身，默认取 Ascend910B 的核数与 UB 大小
+namespace platform_ascendc {
+enum class SocVersion {
+    ASCEND910 = 0,
+    ASCEND910B = 1,
+    ASCEND310P = 2,
+};
+
+enum class CoreMemType {
+    L0_A = 0,
+    L0_B = 1,
+    L0_C = 2,
+    L1 = 3,
+    L2 = 4,
+    UB = 5,
+};
+}
+
+namespace fe {
+class PlatFormInfos {
+public:
+    platform_ascendc::SocVersion soc_version = platform_ascendc::SocVersion::ASCEND910B;
+    uint32_t aiv_num = 48;
+    uint32_t aic_num = 24;
+    uint64_t ub_size = 192 * 1024;
+};
+}
+
+namespace platform_ascendc {
+class PlatformAscendC {
+public:
+    explicit PlatformAscendC(fe::PlatFormInfos *info) : info_(info) {}
+
+    SocVersion GetSocVersion() const
+    {
+        return info_->soc_version;
+    }
+    uint32_t GetCoreNum() const
+    {
+        return info_->aiv_num;
+    }
+    uint32_t GetCoreNumAiv() const
+    {
+        return info_->aiv_num;
+    }
+    uint32_t GetCoreNumAic() const
+    {
+        return info_->aic_num;
+    }
+    void GetCoreMemSize(CoreMemType type, uint64_t &size) const
+    {
+        size = type == CoreMemType::UB ? info_->ub_size : 0;
+    }
+    uint32_t GetLibApiWorkSpaceSize() const
+    {
+        return 16 * 1024 * 1024;
+    }
+    uint32_t CalcTschBlockDim(uint32_t slice_num, uint32_t aic_core_num, uint32_t aiv_core_num) const
+    {
+        if (aic_core_num == 0 || aiv_core_num <= aic_core_num) {
+            return slice_num;
+        }
+        uint32_t ratio = aiv_core_num / aic_core_num;
+        return (slice_num + ratio - 1) / ratio;
+    }
+
+private:
+    fe::PlatFormInfos *info_;
+};
+}
+
+#endif // HOST_BENCH_FAKE_PLATFORM_ASCENDC_H
@@ -0,0 +1,330 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "register/op_def_registry.h"
+#include "tiling/platform/platform_ascendc.h"
+#include "tiling_cache.h"
+
+// 逐个调用各算子的 TilingFunc、InferShape 与 InferDataType，按形状扫描输出每次调用的耗时(ns)。
+// tiling 经缓存的算子另测清空缓存后的冷启动耗时；同时打印 tiling key 与核数，切分结果变化时可直接比对
+namespace {
+// 每项至少计时的时长
+constexpr double MIN_SECONDS = 0.05;
+constexpr uint32_t MIN_ITERATIONS = 64;
+
+// label 为算子名与区分各项的属性
+struct BenchCase {
+    std::string label;
+    gert::NodeDesc node;
+};
+
+const char *DataTypeName(ge::DataType data_type)
+{
+    switch (data_type) {
+        case ge::DT_FLOAT:
+            return "float";
+        case ge::DT_FLOAT16:
+            return "half";
+        case ge::DT_INT32:
+            return "int32";
+        case ge::DT_UINT8:
+            return "uint8";
+        case ge::DT_INT64:
+            return "int64";
+        case ge::DT_BF16:
+            return "bf16";
+        default:
+            return "?";
+    }
+}
+
+std::string ShapeName(const gert::Shape &shape)
+{
+    std::string name = "[";
+    for (size_t i = 0; i < shape.GetDimNum(); i++) {
+        name += (i == 0 ? "" : ",") + std::to_string(shape.GetDim(i));
+    }
+    return name + "]";
+}
+
+// 反复执行 body 直到超过最短计时，返回平均每次的耗时；body 返回失败时返回负数
+template <typename Body>
+double TimePerCall(Body body)
+{
+    using Clock = std::chrono::steady_clock;
+    uint32_t iterations = MIN_ITERATIONS;
+    while (true) {
+        Clock::time_point start = Clock::now();
+        for (uint32_t i = 0; i < iterations; i++) {
+            if (body() != ge::GRAPH_SUCCESS) {
+                return -1.0;
+            }
+        }
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        if (seconds >= MIN_SECONDS) {
+            return seconds * 1e9 / iterations;
+        }
+        iterations *= 2;
+    }
+}
+
+void PrintTime(double ns)
+{
+    if (ns < 0) {
+        printf(" %10s", "FAILED");
+    } else {
+        printf(" %10.1f", ns);
+    }
+}
+
+std::vector<BenchCase> ReduceWithIndexCases(const char *op)
+{
+    struct Shape {
+        gert::Shape dims;
+        int64_t dimension;
+    };
+    // inner > 1、逐列 gather 与长轴切段三种布局各取小、中、大规模
+    const Shape shapes[] = {
+        {{32, 64}, 1}, {{3, 1280, 640}, 2}, {{3, 1280, 640}, 1}, {{1024, 1024}, 1},
+        {{4, 65536}, 1}, {{16, 8, 512}, 0}, {{64, 128, 256}, 1},
+    };
+    const ge::DataType types[] = {ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_INT32, ge::DT_UINT8, ge::DT_BF16};
+    std::vector<BenchCase> cases;
+    for (const Shape &shape : shapes) {
+        for (ge::DataType type : types) {
+            BenchCase bench{std::string(op) + " d=" + std::to_string(shape.dimension), gert::NodeDesc()};
+            bench.node.type = op;
+            bench.node.Input(shape.dims, type).Output(true, ge::DT_INT32).Output();
+            bench.node.attrs.Int(shape.dimension).Bool(false).Bool(false).ListInt({}).ListInt({}).Int(ge::DT_INT32);
+            cases.push_back(bench);
+        }
+    }
+    // int64 的 indices：超过 2^32 个元素与超过 2^24 的归约轴
+    const Shape wide_shapes[] = {
+        {{4, 65536}, 1}, {{65536, 65536}, 1}, {{2, 3, 1LL << 28}, 1}, {{2, 3000000000LL}, 1},
+    };
+    for (const Shape &shape : wide_shapes) {
+        BenchCase bench{std::string(op) + " d=" + std::to_string(shape.dimension) + " int64", gert::NodeDesc()};
+        bench.node.type = op;
+        bench.node.Input(shape.dims, ge::DT_FLOAT).Output(true, ge::DT_INT64).Output();
+        bench.node.attrs.Int(shape.dimension).Bool(false).Bool(false).ListInt({}).ListInt({}).Int(ge::DT_INT64);
+        cases.push_back(bench);
+    }
+    // 非连续的视图：转置、按列切片与三维的维度置换
+    struct View {
+        gert::Shape dims;
+        std::vector<int64_t> strides;
+        int64_t dimension;
+    };
+    const View views[] = {
+        {{1024, 4096}, {1, 1024}, 1}, {{1024, 4096}, {1, 1024}, 0}, {{64, 1000}, {1024, 1}, 1},
+        {{128, 64, 32}, {32, 4096, 1}, 1},
+    };
+    for (const View &view : views) {
+        BenchCase bench{std::string(op) + " d=" + std::to_string(view.dimension) + " strided", gert::NodeDesc()};
+        bench.node.type = op;
+        bench.node.Input(view.dims, ge::DT_FLOAT16).Output(true, ge::DT_INT32).Output();
+        bench.node.attrs.Int(view.dimension).Bool(false).Bool(false);
+        bench.node.attrs.ListInt(view.strides).ListInt({}).Int(ge::DT_INT32);
+        cases.push_back(bench);
+    }
+    // 多个归约维：NCHW 上的 H×W(相邻，合并为一段)、C 与 W(不相邻)、N 与 H×W
+    struct Axes {
+        gert::Shape dims;
+        std::vector<int64_t> axes;
+    };
+    const Axes multi_axes[] = {
+        {{8, 17, 64, 48}, {2, 3}}, {{8, 17, 64, 48}, {-2, -1}}, {{8, 64, 56, 56}, {1, 3}}, {{8, 64, 56, 56}, {0, 2, 3}},
+    };
+    for (const Axes &multi : multi_axes) {
+        std::string axes_name;
+        for (int64_t axis : multi.axes) {
+            axes_name += (axes_name.empty() ? "" : ",") + std::to_string(axis);
+        }
+        BenchCase bench{std::string(op) + " axes=" + axes_name, gert::NodeDesc()};
+        bench.node.type = op;
+        bench.node.Input(multi.dims, ge::DT_FLOAT16).Output(true, ge::DT_INT32).Output();
+        bench.node.attrs.Int(0).Bool(false).Bool(false).ListInt({}).ListInt(multi.axes).Int(ge::DT_INT32);
+        cases.push_back(bench);
+    }
+    // FRACTAL_NZ 的 x：matmul 输出的 logits 沿最后一维归约(含最后一维不是 16 的倍数的)，以及沿 M 归约
+    const Shape nz_shapes[] = {{{4096, 32000}, 1}, {{8, 1000, 1000}, 2}, {{1024, 1024}, 0}};
+    for (const Shape &shape : nz_shapes) {
+        size_t dim_num = shape.dims.GetDimNum();
+        gert::Shape storage;
+        for (size_t i = 0; i + 2 < dim_num; i++) {
+            storage.AppendDim(shape.dims.GetDim(i));
+        }
+        storage.AppendDim((shape.dims.GetDim(dim_num - 1) + 15) / 16);
+        storage.AppendDim((shape.dims.GetDim(dim_num - 2) + 15) / 16);
+        storage.AppendDim(16);
+        storage.AppendDim(16);
+        BenchCase bench{std::string(op) + " d=" + std::to_string(shape.dimension) + " nz", gert::NodeDesc()};
+        bench.node.type = op;
+        bench.node.Input(shape.dims, storage, ge::DT_FLOAT16, ge::FORMAT_FRACTAL_NZ)
+            .Output(true, ge::DT_INT32)
+            .Output();
+        bench.node.attrs.Int(shape.dimension).Bool(false).Bool(false).ListInt({}).ListInt({}).Int(ge::DT_INT32);
+        cases.push_back(bench);
+    }
+    return cases;
+}
+
+std::vector<BenchCase> TopKCases()
+{
+    std::vector<BenchCase> cases;
+    const gert::Shape shapes[] = {{32, 64}, {128, 32000}, {4, 65536}, {8, 1024, 16}};
+    const int64_t ks[] = {1, 4, 8};
+    for (const gert::Shape &shape : shapes) {
+        for (int64_t k : ks) {
+            BenchCase bench{"TopKWithValue k=" + std::to_string(k), gert::NodeDesc()};
+            bench.node.type = "TopKWithValue";
+            bench.node.Input(shape, ge::DT_FLOAT16).Output().Output();
+            bench.node.attrs.Int(k).Int(shape.GetDimNum() == 3 ? 1 : -1).Bool(true);
+            cases.push_back(bench);
+        }
+    }
+    return cases;
+}
+
+std::vector<BenchCase> SegmentCases()
+{
+    std::vector<BenchCase> cases;
+    // 元素数与段数：小输入只用一个核，大输入按元素数均分到全部核
+    const int64_t sizes[][2] = {{1000, 10}, {65536, 1}, {1 << 20, 10000}, {1 << 24, 128}};
+    const ge::DataType types[] = {ge::DT_FLOAT16, ge::DT_FLOAT};
+    for (const auto &size : sizes) {
+        for (ge::DataType type : types) {
+            BenchCase bench{"SegmentArgMaxWithValue s=" + std::to_string(size[1]), gert::NodeDesc()};
+            bench.node.type = "SegmentArgMaxWithValue";
+            bench.node.Input(gert::Shape{size[0]}, type).Input(gert::Shape{size[1] + 1}, ge::DT_INT32);
+            bench.node.Output().Output();
+            cases.push_back(bench);
+        }
+    }
+    return cases;
+}
+
+std::vector<BenchCase> SinhCases()
+{
+    std::vector<BenchCase> cases;
+    const gert::Shape shapes[] = {{0}, {1024}, {8, 1024, 128}, {64, 1024, 1024}};
+    const char *modes[] = {"sinh", "sinh,cosh,tanh", "cosh,tanh"};
+    const ge::DataType types[] = {ge::DT_FLOAT16, ge::DT_BF16};
+    for (const gert::Shape &shape : shapes) {
+        for (const char *mode : modes) {
+            for (ge::DataType type : types) {
+                BenchCase bench{std::string("SinhCustom ") + mode, gert::NodeDesc()};
+                bench.node.type = "SinhCustom";
+                // 只连接 mode 选中的输出
+                bench.node.Input(shape, type).Output(strstr(mode, "sinh") != nullptr).Output(
+                    strstr(mode, "cosh") != nullptr).Output(strstr(mode, "tanh") != nullptr);
+                bench.node.attrs.Str(mode);
+                cases.push_back(bench);
+            }
+        }
+    }
+    return cases;
+}
+
+std::vector<BenchCase> LossCases()
+{
+    std::vector<BenchCase> cases;
+    const int64_t sizes[][2] = {{32, 10}, {4096, 1000}, {4096, 32000}, {65536, 128}};
+    const char *reductions[] = {"mean", "none"};
+    for (const auto &size : sizes) {
+        for (const char *reduction : reductions) {
+            gert::Shape x{size[0], size[1]};
+            gert::Shape target{size[0]};
+            gert::Shape weight{size[1]};
+            const char *ops[] = {"NLLLoss", "CrossEntropyLoss"};
+            for (const char *op : ops) {
+                BenchCase bench{std::string(op) + " " + reduction, gert::NodeDesc()};
+                bench.node.type = op;
+                bench.node.Input(x, ge::DT_FLOAT).Input(target, ge::DT_INT32).Input(weight, ge::DT_FLOAT).Output();
+                bench.node.attrs.Str(reduction).Int(-100);
+                cases.push_back(bench);
+            }
+            BenchCase grad{std::string("NLLLossGrad ") + reduction, gert::NodeDesc()};
+            grad.node.type = "NLLLossGrad";
+            gert::Shape grad_y = strcmp(reduction, "none") == 0 ? target : gert::Shape{1};
+            grad.node.Input(grad_y, ge::DT_FLOAT).Input(x, ge::DT_FLOAT).Input(target, ge::DT_INT32);
+            grad.node.Input(weight, ge::DT_FLOAT).Output();
+            grad.node.attrs.Str(reduction).Int(-100);
+            cases.push_back(grad);
+        }
+    }
+    return cases;
+}
+
+// 只测名称中含 filter 的算子
+void RunCases(const std::vector<BenchCase> &cases, const char *filter, fe::PlatFormInfos *platform)
+{
+    for (const BenchCase &bench : cases) {
+        if (filter != nullptr && bench.label.find(filter) == std::string::npos) {
+            continue;
+        }
+        std::unique_ptr<ops::OpDef> op(ops::OpDefRegistry::Create(bench.node.type.c_str()));
+        if (op == nullptr) {
+            printf("%-32s not registered\n", bench.label.c_str());
+            continue;
+        }
+        ops::TilingKernelFunc tiling = op->AICore().GetTiling();
+        ops::InferShapeKernelFunc infer_shape = op->GetInferShape();
+        ops::InferDataTypeKernelFunc infer_data_type = op->GetInferDataType();
+
+        gert::TilingContext context(bench.node, platform);
+        double warm = TimePerCall([&]() { return tiling(&context); });
+        double cold = TimePerCall([&]() {
+            optiling::ClearTilingCache();
+            return tiling(&context);
+        });
+        double shape_ns = TimePerCall([&]() {
+            gert::InferShapeContext infer_context(bench.node);
+            return infer_shape(&infer_context);
+        });
+        double type_ns = -1.0;
+        if (infer_data_type != nullptr) {
+            type_ns = TimePerCall([&]() {
+                gert::InferDataTypeContext infer_context(bench.node);
+                return infer_data_type(&infer_context);
+            });
+        }
+
+        const gert::Shape &x_shape = bench.node.input_shapes[bench.node.type == "NLLLossGrad" ? 1 : 0].GetStorageShape();
+        printf("%-32s %-22s %-6s", bench.label.c_str(), ShapeName(x_shape).c_str(),
+               DataTypeName(bench.node.input_descs[0].GetDataType()));
+        PrintTime(warm);
+        PrintTime(cold);
+        PrintTime(shape_ns);
+        if (infer_data_type != nullptr) {
+            PrintTime(type_ns);
+        } else {
+            printf(" %10s", "-");
+        }
+        printf(" %6llu %4u\n", static_cast<unsigned long long>(context.GetTilingKey()), context.GetBlockDim());
+    }
+}
+}
+
+int main(int argc, char **argv)
+{
+    const char *filter = argc > 1 ? argv[1] : nullptr;
+    fe::PlatFormInfos platform;
+    printf("%-32s %-22s %-6s %10s %10s %10s %10s %6s %4s\n", "op", "x", "dtype", "tiling", "tiling(cold)",
+           "infershape", "inferdtype", "key", "dim");
+    RunCases(ReduceWithIndexCases("ArgMaxWithValue"), filter, &platform);
+    RunCases(ReduceWithIndexCases("ArgMinWithValue"), filter, &platform);
+    RunCases(ReduceWithIndexCases("ArgMaxWithValueCase"), filter, &platform);
+    RunCases(TopKCases(), filter, &platform);
+    RunCases(SegmentCases(), filter, &platform);
+    RunCases(SinhCases(), filter, &platform);
+    RunCases(LossCases(), filter, &platform);
+    printf("tiling cache: %llu hits, %llu misses\n", static_cast<unsigned long long>(OptilingTilingCacheHits()),
+           static_cast<unsigned long long>(OptilingTilingCacheMisses()));
+    return 0;
+}
@@ -0,0 +1,242 @@
+
+#include <algorithm>
+#include <vector>
+#include "mat_mul_sub_tiling.h"
+#include "register/op_def_registry.h"
+#include "tiling/platform/platform_ascendc.h"
+
+
+namespace optiling {
+// x2 以 ND 格式输入，每次调用由 MTE 按 ND 读入后在片上转成分形
+constexpr uint64_t TILING_KEY_X2_ND = 1;
+// x2 已预先打包为 FRACTAL_NZ，直接按分形块搬运
+constexpr uint64_t TILING_KEY_X2_NZ = 2;
+// 结果块与 x3、输出块需同时驻留 UB，限制 base 块大小
+constexpr int32_t MAX_BASE_M = 64;
+constexpr int32_t MAX_BASE_N = 128;
+constexpr int32_t CUBE_ALIGN = 16;
+
+static int32_t CeilAlign(int32_t value, int32_t align)
+{
+    return (value + align - 1) / align * align;
+}
+
+// 除最后 matrix_dims 维外的各维展平为 batch，2 维输入的 batch 为 1，按 batch 广播
+static int64_t GetBatch(const gert::Shape &shape, size_t matrix_dims)
+{
+    int64_t batch = 1;
+    for (size_t i = 0; i + matrix_dims < shape.GetDimNum(); ++i) {
+        batch *= shape.GetDim(i);
+    }
+    return batch;
+}
+
+// x1、x2 的 batch 维为除最后两维外的各维，x3 为除最后 min(rank, 2) 维外的各维。各自右对齐后逐维广播
+// (相等或为 1)，结果写入 batch_dims；核内按展平后的 batch 广播，因此各输入的 batch 须与结果相同或全为 1。
+// 调用方保证 x1、x2 至少 2 维、x3 至少 1 维；含动态维(-1)时只检查可广播
+static bool BroadcastBatchDims(const gert::Shape &x1_shape, const gert::Shape &x2_shape, const gert::Shape &x3_shape,
+                               std::vector<int64_t> &batch_dims)
+{
+    const gert::Shape *shapes[] = {&x1_shape, &x2_shape, &x3_shape};
+    size_t batch_ranks[] = {x1_shape.GetDimNum() - 2, x2_shape.GetDimNum() - 2,
+                            x3_shape.GetDimNum() - std::min<size_t>(x3_shape.GetDimNum(), 2)};
+    size_t rank = std::max(batch_ranks[0], std::max(batch_ranks[1], batch_ranks[2]));
+    batch_dims.assign(rank, 1);
+    for (size_t s = 0; s < 3; ++s) {
+        for (size_t i = 0; i < batch_ranks[s]; ++i) {
+            int64_t dim = shapes[s]->GetDim(i);
+            int64_t &out = batch_dims[rank - batch_ranks[s] + i];
+            if (dim == out || dim == 1) {
+                continue;
+            }
+            if (out != 1) {
+                return false;
+            }
+            out = dim;
+        }
+    }
+    int64_t batch = 1;
+    for (int64_t dim : batch_dims) {
+        if (dim < 0) {
+            return true;
+        }
+        batch *= dim;
+    }
+    for (size_t s = 0; s < 3; ++s) {
+        int64_t operand_batch = GetBatch(*shapes[s], shapes[s]->GetDimNum() - batch_ranks[s]);
+        if (operand_batch != 1 && operand_batch != batch) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static ge::graphStatus TilingFunc(gert::TilingContext* context)
+{
+    MatMulSubTilingData tiling;
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    const gert::Shape &x1_shape = context->GetInputShape(0)->GetOriginShape();
+    const gert::Shape &x2_shape = context->GetInputShape(1)->GetOriginShape();
+    const gert::Shape &x3_shape = context->GetInputShape(2)->GetOriginShape();
+    size_t x1_rank = x1_shape.GetDimNum();
+    size_t x2_rank = x2_shape.GetDimNum();
+    size_t x3_rank = x3_shape.GetDimNum();
+    if (x1_rank < 2 || x2_rank < 2 || x3_rank < 1) {
+        return ge::GRAPH_FAILED;
+    }
+    // 转置时 x1 按 [K, M]、x2 按 [N, K] 存放，由 Matmul 在搬入分形时完成转置
+    const gert::RuntimeAttrs *attrs = context->GetAttrs();
+    bool trans_x1 = *(attrs->GetAttrPointer<bool>(0));
+    bool trans_x2 = *(attrs->GetAttrPointer<bool>(1));
+    int32_t m = x1_shape.GetDim(trans_x1 ? x1_rank - 1 : x1_rank - 2);
+    int32_t k = x1_shape.GetDim(trans_x1 ? x1_rank - 2 : x1_rank - 1);
+    int32_t n = x2_shape.GetDim(trans_x2 ? x2_rank - 2 : x2_rank - 1);
+
+    // batch 维逐维广播，与 InferShape 推导的 y 一致；各输入的 batch 要么与 y 相同，要么为 1 按 batch 广播
+    std::vector<int64_t> batch_dims;
+    if (!BroadcastBatchDims(x1_shape, x2_shape, x3_shape, batch_dims)) {
+        return ge::GRAPH_FAILED;
+    }
+    int64_t x1_batch = GetBatch(x1_shape, 2);
+    int64_t x2_batch = GetBatch(x2_shape, 2);
+    int64_t x3_batch = GetBatch(x3_shape, std::min<size_t>(x3_rank, 2));
+    int64_t batch = 1;
+    for (int64_t dim : batch_dims) {
+        batch *= dim;
+    }
+
+    matmul_tiling::DataType dtype = matmul_tiling::DataType::DT_FLOAT;
+    int32_t c0 = CUBE_ALIGN / 2;
+    if (context->GetInputDesc(0)->GetDataType() == ge::DT_FLOAT16) {
+        dtype = matmul_tiling::DataType::DT_FLOAT16;
+        c0 = CUBE_ALIGN;
+    }
+    bool x2_nz = ge::GetPrimaryFormat(context->GetInputDesc(1)->GetStorageFormat()) == ge::FORMAT_FRACTAL_NZ;
+    // NZ 按存放时的行、列分别对齐到 16 和 c0
+    int32_t x2_rows = trans_x2 ? n : k;
+    int32_t x2_cols = trans_x2 ? k : n;
+    uint32_t x2_matrix_size = x2_nz ? CeilAlign(x2_rows, CUBE_ALIGN) * CeilAlign(x2_cols, c0) : k * n;
+    uint32_t x3_row_stride = (x3_rank >= 2 && x3_shape.GetDim(x3_rank - 2) != 1) ? n : 0;
+    uint32_t x3_matrix_size = x3_row_stride == 0 ? n : m * n;
+    tiling.set_x3_row_stride(x3_row_stride);
+    tiling.set_batch(batch);
+    tiling.set_x1_batch_stride(x1_batch == 1 ? 0 : m * k);
+    tiling.set_x2_batch_stride(x2_batch == 1 ? 0 : x2_matrix_size);
+    tiling.set_x3_batch_stride(x3_batch == 1 ? 0 : x3_matrix_size);
+
+    int32_t base_m = std::min(CeilAlign(m, CUBE_ALIGN), MAX_BASE_M);
+    int32_t base_n = std::min(CeilAlign(n, CUBE_ALIGN), MAX_BASE_N);
+    uint32_t aiv_num = ascendcPlatform.GetCoreNumAiv();
+    uint32_t aic_num = ascendcPlatform.GetCoreNumAic();
+    // 单个 batch 的 base 块数不足以铺满所有核时，把核分组，各组并行处理不同的 batch
+    uint32_t tile_num = ((m + base_m - 1) / base_m) * ((n + base_n - 1) / base_n);
+    uint32_t batch_core_num = 1;
+    if (tile_num < aiv_num) {
+        batch_core_num = std::min<uint32_t>(batch, aiv_num / tile_num);
+    }
+    tiling.set_batch_core_num(batch_core_num);
+    tiling.set_trans_x1(trans_x1 ? 1 : 0);
+    tiling.set_trans_x2(trans_x2 ? 1 : 0);
+
+    matmul_tiling::MultiCoreMatmulTiling cube_tiling(ascendcPlatform);
+    cube_tiling.SetDim(aiv_num / batch_core_num);
+    cube_tiling.SetAType(matmul_tiling::TPosition::GM, matmul_tiling::CubeFormat::ND, dtype, trans_x1);
+    cube_tiling.SetBType(matmul_tiling::TPosition::GM,
+                         x2_nz ? matmul_tiling::CubeFormat::NZ : matmul_tiling::CubeFormat::ND, dtype, trans_x2);
+    // 累加结果统一以 fp32 留在 UB，与 x3 相减后再转回输出类型
+    cube_tiling.SetCType(matmul_tiling::TPosition::VECIN, matmul_tiling::CubeFormat::ND,
+                         matmul_tiling::DataType::DT_FLOAT);
+    cube_tiling.SetShape(m, n, k);
+    cube_tiling.SetOrgShape(m, n, k);
+    cube_tiling.SetBias(false);
+    cube_tiling.SetFixSplit(base_m, base_n, -1);
+    cube_tiling.SetTraverse(matmul_tiling::MatrixTraverse::FIRSTM);
+    cube_tiling.SetBufferSpace(-1, -1, -1);
+    if (cube_tiling.GetTiling(tiling.cube_tiling) == -1) {
+        return ge::GRAPH_FAILED;
+    }
+
+    context->SetTilingKey(x2_nz ? TILING_KEY_X2_NZ : TILING_KEY_X2_ND);
+    uint32_t used_core_num = tiling.cube_tiling.get_usedCoreNum() * batch_core_num;
+    context->SetBlockDim(ascendcPlatform.CalcTschBlockDim(used_core_num, aic_num, aiv_num));
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+    size_t *currentWorkspace = context->GetWorkspaceSizes(1);
+    currentWorkspace[0] = ascendcPlatform.GetLibApiWorkSpaceSize();
+    return ge::GRAPH_SUCCESS;
+}
+}
+
+
+namespace ge {
+static ge::graphStatus InferShape(gert::InferShapeContext* context)
+{
+    const gert::Shape* x1_shape = context->GetInputShape(0);
+    const gert::Shape* x2_shape = context->GetInputShape(1);
+    const gert::Shape* x3_shape = context->GetInputShape(2);
+    gert::Shape* y_shape = context->GetOutputShape(0);
+    size_t x1_rank = x1_shape->GetDimNum();
+    size_t x2_rank = x2_shape->GetDimNum();
+    if (x1_rank < 2 || x2_rank < 2 || x3_shape->GetDimNum() < 1) {
+        return GRAPH_FAILED;
+    }
+    // batch 维由 x1、x2、x3 逐维广播得到，与 tiling 按 y 计算的 batch 一致
+    std::vector<int64_t> batch_dims;
+    if (!optiling::BroadcastBatchDims(*x1_shape, *x2_shape, *x3_shape, batch_dims)) {
+        return GRAPH_FAILED;
+    }
+    size_t y_rank = batch_dims.size() + 2;
+    y_shape->SetDimNum(y_rank);
+    for (size_t i = 0; i < batch_dims.size(); ++i) {
+        y_shape->SetDim(i, batch_dims[i]);
+    }
+    const gert::RuntimeAttrs *attrs = context->GetAttrs();
+    bool trans_x1 = *(attrs->GetAttrPointer<bool>(0));
+    bool trans_x2 = *(attrs->GetAttrPointer<bool>(1));
+    y_shape->SetDim(y_rank - 2, x1_shape->GetDim(trans_x1 ? x1_rank - 1 : x1_rank - 2));
+    y_shape->SetDim(y_rank - 1, x2_shape->GetDim(trans_x2 ? x2_rank - 2 : x2_rank - 1));
+    return GRAPH_SUCCESS;
+}
+}
+
+
+namespace ops {
+class MatMulSub : public OpDef {
+public:
+    explicit MatMulSub(const char* name) : OpDef(name)
+    {
+        this->Input("x1")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        // 权重常驻场景下 x2 可由调用方一次性打包成 FRACTAL_NZ 并复用
+        this->Input("x2")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_FRACTAL_NZ, ge::FORMAT_FRACTAL_NZ})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_FRACTAL_NZ, ge::FORMAT_FRACTAL_NZ});
+        this->Input("x3")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Output("y")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        // x1 以 [K, M]、x2 以 [N, K] 存放时置为 true，无需额外的转置算子
+        this->Attr("transpose_x1").AttrType(OPTIONAL).Bool(false);
+        this->Attr("transpose_x2").AttrType(OPTIONAL).Bool(false);
+
+        this->SetInferShape(ge::InferShape);
+
+        this->AICore()
+            .SetTiling(optiling::TilingFunc);
+        this->AICore().AddConfig("ascend910b");
+    }
+};
+
+OP_ADD(MatMulSub);
+}
@@ -0,0 +1,22 @@
+
+#include "register/tilingdata_base.h"
+#include "tiling/tiling_api.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(MatMulSubTilingData)
+  TILING_DATA_FIELD_DEF_STRUCT(TCubeTiling, cube_tiling);
+  // x3 相邻两行的元素间隔，x3 为 [N] 按行广播时为 0
+  TILING_DATA_FIELD_DEF(uint32_t, x3_row_stride);
+  TILING_DATA_FIELD_DEF(uint32_t, batch);
+  // 各输入相邻两个 batch 的元素间隔，按 batch 广播的输入为 0
+  TILING_DATA_FIELD_DEF(uint32_t, x1_batch_stride);
+  TILING_DATA_FIELD_DEF(uint32_t, x2_batch_stride);
+  TILING_DATA_FIELD_DEF(uint32_t, x3_batch_stride);
+  // 同时处理不同 batch 的核组数，每组 cube_tiling.usedCoreNum 个核切分一个 batch 的 M、N
+  TILING_DATA_FIELD_DEF(uint32_t, batch_core_num);
+  TILING_DATA_FIELD_DEF(uint32_t, trans_x1);
+  TILING_DATA_FIELD_DEF(uint32_t, trans_x2);
+END_TILING_DATA_DEF;
+
+REGISTER_TILING_DATA_CLASS(MatMulSub, MatMulSubTilingData)
+}
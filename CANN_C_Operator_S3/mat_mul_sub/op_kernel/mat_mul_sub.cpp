@@ -0,0 +1,225 @@
+#include "kernel_operator.h"
+#include "lib/matmul_intf.h"
+using namespace AscendC;
+
+__aicore__ inline uint32_t CeilAlign(uint32_t value, uint32_t align)
+{
+    return (value + align - 1) / align * align;
+}
+
+template <typename T, CubeFormat B_FORMAT>
+class KernelMatMulSub {
+public:
+    // 开启 ISTRANS，转置与否由 SetTensorA/B 在运行时指定
+    using AType = matmul::MatmulType<TPosition::GM, CubeFormat::ND, T, true>;
+    using BType = matmul::MatmulType<TPosition::GM, B_FORMAT, T, true>;
+    using CType = matmul::MatmulType<TPosition::VECIN, CubeFormat::ND, float>;
+    using BiasType = matmul::MatmulType<TPosition::GM, CubeFormat::ND, float>;
+
+    __aicore__ inline KernelMatMulSub() {}
+
+    // 初始化
+    __aicore__ inline void Init(GM_ADDR x1, GM_ADDR x2, GM_ADDR x3, GM_ADDR y, const MatMulSubTilingData &tilingData,
+                                TPipe *pipeIn)
+    {
+        tiling = tilingData.cube_tiling;
+        x3Stride = tilingData.x3_row_stride;
+        batch = tilingData.batch;
+        x1BatchStride = tilingData.x1_batch_stride;
+        x2BatchStride = tilingData.x2_batch_stride;
+        x3BatchStride = tilingData.x3_batch_stride;
+        batchCoreNum = tilingData.batch_core_num;
+        transX1 = tilingData.trans_x1 != 0;
+        transX2 = tilingData.trans_x2 != 0;
+        pipe = pipeIn;
+        x1Global.SetGlobalBuffer((__gm__ T *)x1);
+        // NZ 格式的 x2 在 K、N 方向都带有对齐填充，长度不等于 K * N
+        x2Global.SetGlobalBuffer((__gm__ T *)x2);
+        x3Global.SetGlobalBuffer((__gm__ T *)x3);
+        yGlobal.SetGlobalBuffer((__gm__ T *)y, batch * tiling.M * tiling.N);
+        // 核按组划分：组内各核切分同一 batch 的 M、N，不同组轮流处理不同 batch
+        batchGroup = GetBlockIdx() / tiling.usedCoreNum;
+        CalcOffset(GetBlockIdx() % tiling.usedCoreNum);
+
+        uint32_t baseSize = tiling.baseM * tiling.baseN;
+        pipe->InitBuffer(mmOutQueue, 1, baseSize * sizeof(float));
+        pipe->InitBuffer(x3InQueue, 1, baseSize * sizeof(T));
+        pipe->InitBuffer(yOutQueue, 1, baseSize * sizeof(T));
+        if constexpr (!IsSameType<T, float>::value) {
+            pipe->InitBuffer(castBuf, baseSize * sizeof(float));
+        }
+    }
+
+    // 计算过程：每取出一个 baseM x baseN 的结果块，就地减去对应的 x3 块后写回
+    __aicore__ inline void Process()
+    {
+        if (batchGroup >= batchCoreNum) {
+            return;
+        }
+        for (uint32_t b = batchGroup; b < batch; b += batchCoreNum) {
+            ProcessBatch(b);
+        }
+        mm.End();
+    }
+
+private:
+    __aicore__ inline void ProcessBatch(uint32_t b)
+    {
+        mm.SetTensorA(x1Global[b * x1BatchStride + offsetA], transX1);
+        mm.SetTensorB(x2Global[b * x2BatchStride + offsetB], transX2);
+        mm.SetTail(tailM, tailN);
+
+        uint32_t x3Offset = b * x3BatchStride;
+        uint32_t yOffset = b * tiling.M * tiling.N;
+        uint32_t mIter = (tailM + tiling.baseM - 1) / tiling.baseM;
+        uint32_t count = 0;
+        while (mm.template Iterate<true>()) {
+            uint32_t mIdx = count % mIter;
+            uint32_t nIdx = count / mIter;
+            uint32_t curM = tailM - mIdx * tiling.baseM;
+            uint32_t curN = tailN - nIdx * tiling.baseN;
+            curM = curM < tiling.baseM ? curM : tiling.baseM;
+            curN = curN < tiling.baseN ? curN : tiling.baseN;
+            uint32_t row = mStart + mIdx * tiling.baseM;
+            uint32_t col = nStart + nIdx * tiling.baseN;
+            CopyIn(x3Offset + row * x3Stride + col, curM, curN);
+            Compute(curM, curN);
+            CopyOut(yOffset + row * tiling.N + col, curM, curN);
+            count++;
+        }
+    }
+
+    __aicore__ inline void CalcOffset(int32_t blockIdx)
+    {
+        uint32_t mBlocks = (tiling.M + tiling.singleCoreM - 1) / tiling.singleCoreM;
+        mStart = blockIdx % mBlocks * tiling.singleCoreM;
+        nStart = blockIdx / mBlocks * tiling.singleCoreN;
+        tailM = tiling.M - mStart < tiling.singleCoreM ? tiling.M - mStart : tiling.singleCoreM;
+        tailN = tiling.N - nStart < tiling.singleCoreN ? tiling.N - nStart : tiling.singleCoreN;
+        // 转置的 x1 为 [K, M]，起始列即 mStart
+        offsetA = transX1 ? mStart : mStart * tiling.Ka;
+        if constexpr (B_FORMAT == CubeFormat::NZ) {
+            // NZ 中每 C0 列为一个分形列块，块内按行方向 16 对齐后连续存放
+            constexpr uint32_t c0 = ONE_BLK_SIZE / sizeof(T);
+            offsetB = transX2 ? nStart * c0 : nStart * CeilAlign(tiling.Kb, BLOCK_CUBE);
+        } else {
+            offsetB = transX2 ? nStart * tiling.Kb : nStart;
+        }
+    }
+
+    __aicore__ inline void CopyIn(uint32_t x3Offset, uint32_t curM, uint32_t curN)
+    {
+        LocalTensor<T> x3Local = x3InQueue.AllocTensor<T>();
+        uint32_t rows = x3Stride == 0 ? 1 : curM;
+        uint32_t rowBytes = curN * sizeof(T);
+        DataCopyExtParams copyParams{static_cast<uint16_t>(rows), rowBytes,
+                                     rows == 1 ? 0 : (x3Stride - curN) * static_cast<uint32_t>(sizeof(T)),
+                                     (tiling.baseN * static_cast<uint32_t>(sizeof(T)) - CeilAlign(rowBytes, ONE_BLK_SIZE)) /
+                                         ONE_BLK_SIZE,
+                                     0};
+        DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+        DataCopyPad(x3Local, x3Global[x3Offset], copyParams, padParams);
+        x3InQueue.EnQue(x3Local);
+    }
+
+    __aicore__ inline void Compute(uint32_t curM, uint32_t curN)
+    {
+        LocalTensor<float> cLocal = mmOutQueue.AllocTensor<float>();
+        mm.template GetTensorC<true>(cLocal, false, true);
+        mmOutQueue.EnQue(cLocal);
+        cLocal = mmOutQueue.DeQue<float>();
+        LocalTensor<T> x3Local = x3InQueue.DeQue<T>();
+        LocalTensor<T> yLocal = yOutQueue.AllocTensor<T>();
+        uint32_t count = curM * tiling.baseN;
+        if constexpr (IsSameType<T, float>::value) {
+            SubX3(yLocal, cLocal, x3Local, curM, count);
+        } else {
+            LocalTensor<float> x3Float = castBuf.Get<float>();
+            Cast(x3Float, x3Local, RoundMode::CAST_NONE, x3Stride == 0 ? tiling.baseN : count);
+            SubX3(cLocal, cLocal, x3Float, curM, count);
+            Cast(yLocal, cLocal, RoundMode::CAST_RINT, count);
+        }
+        yOutQueue.EnQue(yLocal);
+        x3InQueue.FreeTensor(x3Local);
+        mmOutQueue.FreeTensor(cLocal);
+    }
+
+    // x3 为 [N] 时只搬入一行，按 repeat 步长为 0 广播到 curM 行；
+    // baseN 不是 64 的倍数时最后一段只算剩余的列，不越过行尾写到下一行
+    __aicore__ inline void SubX3(const LocalTensor<float> &dst, const LocalTensor<float> &c,
+                                 const LocalTensor<float> &x3, uint32_t curM, uint32_t count)
+    {
+        if (x3Stride != 0) {
+            Sub(dst, c, x3, count);
+            return;
+        }
+        constexpr uint32_t repeatElems = ONE_REPEAT_BYTE_SIZE / sizeof(float);
+        uint8_t rowStride = static_cast<uint8_t>(tiling.baseN * sizeof(float) / ONE_BLK_SIZE);
+        BinaryRepeatParams repeatParams{1, 1, 1, rowStride, rowStride, 0};
+        for (uint32_t i = 0; i < tiling.baseN; i += repeatElems) {
+            uint64_t mask = tiling.baseN - i < repeatElems ? tiling.baseN - i : repeatElems;
+            Sub(dst[i], c[i], x3[i], mask, static_cast<uint8_t>(curM), repeatParams);
+        }
+    }
+
+    __aicore__ inline void CopyOut(uint32_t yOffset, uint32_t curM, uint32_t curN)
+    {
+        LocalTensor<T> yLocal = yOutQueue.DeQue<T>();
+        uint32_t rowBytes = curN * sizeof(T);
+        DataCopyExtParams copyParams{static_cast<uint16_t>(curM), rowBytes,
+                                     (tiling.baseN * static_cast<uint32_t>(sizeof(T)) - CeilAlign(rowBytes, ONE_BLK_SIZE)) /
+                                         ONE_BLK_SIZE,
+                                     (tiling.N - curN) * static_cast<uint32_t>(sizeof(T)), 0};
+        DataCopyPad(yGlobal[yOffset], yLocal, copyParams);
+        yOutQueue.FreeTensor(yLocal);
+    }
+
+public:
+    matmul::Matmul<AType, BType, CType, BiasType> mm;
+
+private:
+    TPipe *pipe;
+    TQue<QuePosition::VECIN, 1> mmOutQueue;
+    TQue<QuePosition::VECIN, 1> x3InQueue;
+    TQue<QuePosition::VECOUT, 1> yOutQueue;
+    TBuf<QuePosition::VECCALC> castBuf;
+
+    GlobalTensor<T> x1Global;
+    GlobalTensor<T> x2Global;
+    GlobalTensor<T> x3Global;
+    GlobalTensor<T> yGlobal;
+
+    TCubeTiling tiling;
+    uint32_t x3Stride;
+    uint32_t batch;
+    uint32_t x1BatchStride;
+    uint32_t x2BatchStride;
+    uint32_t x3BatchStride;
+    uint32_t batchCoreNum;
+    uint32_t batchGroup;
+    bool transX1;
+    bool transX2;
+    uint32_t mStart;
+    uint32_t nStart;
+    uint32_t tailM;
+    uint32_t tailN;
+    uint32_t offsetA;
+    uint32_t offsetB;
+};
+
+extern "C" __global__ __aicore__ void mat_mul_sub(GM_ADDR x1, GM_ADDR x2, GM_ADDR x3, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling) {
+    GET_TILING_DATA(tiling_data, tiling);
+    SetSysWorkspace(workspace);
+    TPipe pipe;
+    if (TILING_KEY_IS(1)) {
+        KernelMatMulSub<DTYPE_X1, CubeFormat::ND> op;
+        REGIST_MATMUL_OBJ(&pipe, GetSysWorkSpacePtr(), op.mm, &tiling_data.cube_tiling);
+        op.Init(x1, x2, x3, y, tiling_data, &pipe);
+        op.Process();
+    } else if (TILING_KEY_IS(2)) {
+        KernelMatMulSub<DTYPE_X1, CubeFormat::NZ> op;
+        REGIST_MATMUL_OBJ(&pipe, GetSysWorkSpacePtr(), op.mm, &tiling_data.cube_tiling);
+        op.Init(x1, x2, x3, y, tiling_data, &pipe);
+        op.Process();
+    }
+}
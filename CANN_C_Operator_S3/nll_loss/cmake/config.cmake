@@ -0,0 +1,29 @@
+
+set(CMAKE_CXX_FLAGS_DEBUG "")
+set(CMAKE_CXX_FLAGS_RELEASE "")
+
+if (NOT DEFINED vendor_name)
+    set(vendor_name customize CACHE STRING "")
+endif()
+if (NOT DEFINED ASCEND_CANN_PACKAGE_PATH)
+    set(ASCEND_CANN_PACKAGE_PATH /usr/local/Ascend/latest CACHE PATH "")
+endif()
+if (NOT DEFINED ASCEND_PYTHON_EXECUTABLE)
+    set(ASCEND_PYTHON_EXECUTABLE python3 CACHE STRING "")
+endif()
+if (NOT DEFINED ASCEND_COMPUTE_UNIT)
+    message(FATAL_ERROR "ASCEND_COMPUTE_UNIT not set in CMakePreset.json ! 
+")
+endif()
+set(ASCEND_TENSOR_COMPILER_PATH ${ASCEND_CANN_PACKAGE_PATH}/compiler)
+set(ASCEND_CCEC_COMPILER_PATH ${ASCEND_TENSOR_COMPILER_PATH}/ccec_compiler/bin)
+set(ASCEND_AUTOGEN_PATH ${CMAKE_BINARY_DIR}/autogen)
+set(ASCEND_FRAMEWORK_TYPE tensorflow)
+file(MAKE_DIRECTORY ${ASCEND_AUTOGEN_PATH})
+set(CUSTOM_COMPILE_OPTIONS "custom_compile_options.ini")
+set(CUSTOM_OPC_OPTIONS "custom_opc_options.ini")
+execute_process(COMMAND rm -rf ${ASCEND_AUTOGEN_PATH}/${CUSTOM_COMPILE_OPTIONS}
+                COMMAND rm -rf ${ASCEND_AUTOGEN_PATH}/${CUSTOM_OPC_OPTIONS}
+                COMMAND touch ${ASCEND_AUTOGEN_PATH}/${CUSTOM_COMPILE_OPTIONS}
+                COMMAND touch ${ASCEND_AUTOGEN_PATH}/${CUSTOM_OPC_OPTIONS}
+                )
@@ -0,0 +1,8 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import sys
+import os
+
+PYF_PATH = os.path.dirname(os.path.realpath(__file__))
+sys.path.append(PYF_PATH)
@@ -0,0 +1,105 @@
+
+#include "cross_entropy_loss_tiling.h"
+#include "loss_tiling_common.h"
+
+
+namespace optiling {
+constexpr uint32_t BUFFER_NUM = 2;
+// 列方向按 64 个 float(256B) 一组做折叠规约
+constexpr uint32_t CHUNK_ALIGN = 64;
+// 单次搬入的最大类别数，行跨度以 32B 块计需不超过 255
+constexpr uint32_t MAX_CHUNK_LENGTH = 1024;
+// 以行为 repeat 做折叠与整行规约，repeat 次数不超过 255
+constexpr uint32_t MAX_TILE_LENGTH = 248;
+constexpr uint32_t BLOCK_SIZE = 32;
+
+static ge::graphStatus TilingFunc(gert::TilingContext* context)
+{
+    CrossEntropyLossTilingData tiling;
+    LossTilingParam param;
+    if (ParseLossInput(context, param) != ge::GRAPH_SUCCESS) {
+        return ge::GRAPH_FAILED;
+    }
+    uint32_t chunk_length = std::min(CeilDiv(param.c, CHUNK_ALIGN) * CHUNK_ALIGN, MAX_CHUNK_LENGTH);
+    // 每个样本在 UB 中需要：x 的一块与 target(双缓冲)、64 列的折叠结果、行最大值的 8 倍广播，
+    // 以及行最大值、指数和、块统计、临时量、目标 logit、安全 target、块内 target、命中掩码、gather 结果、
+    // 偏移与行偏移各一个，命中判断的两组位掩码
+    uint64_t sample_bytes = BUFFER_NUM * (chunk_length + 1) * sizeof(float) + (CHUNK_ALIGN + 8) * sizeof(float) +
+                            11 * sizeof(float) + 2;
+    // weight 优先整体常驻 UB；C 很大放不下时改为按 target 从 GM 逐个取，每个样本多占一个 32B 块与块偏移
+    bool weight_resident = true;
+    if (SplitLossSamples(context, param.c_align * sizeof(float), sample_bytes, MAX_TILE_LENGTH, param) !=
+        ge::GRAPH_SUCCESS) {
+        weight_resident = false;
+        sample_bytes += BLOCK_SIZE + sizeof(int32_t);
+        if (SplitLossSamples(context, 0, sample_bytes, MAX_TILE_LENGTH, param) != ge::GRAPH_SUCCESS) {
+            return ge::GRAPH_FAILED;
+        }
+    }
+
+    tiling.set_n(param.n);
+    tiling.set_c(param.c);
+    tiling.set_c_align(param.c_align);
+    tiling.set_reduction(param.reduction);
+    tiling.set_ignore_index(param.ignore_index);
+    tiling.set_block_length(param.block_length);
+    tiling.set_tile_length(param.tile_length);
+    tiling.set_used_core_num(param.used_core_num);
+    tiling.set_deterministic(param.deterministic ? 1 : 0);
+    tiling.set_chunk_length(chunk_length);
+    tiling.set_weight_resident(weight_resident ? 1 : 0);
+
+    SetLossLaunch(context, param);
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+    return ge::GRAPH_SUCCESS;
+}
+}
+
+
+namespace ge {
+static ge::graphStatus InferShape(gert::InferShapeContext* context)
+{
+    return optiling::InferLossShape(context);
+}
+}
+
+
+namespace ops {
+class CrossEntropyLoss : public OpDef {
+public:
+    explicit CrossEntropyLoss(const char* name) : OpDef(name)
+    {
+        this->Input("x")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND});
+        this->Input("target")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_INT32})
+            .Format({ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND});
+        this->Input("weight")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND});
+        this->Output("y")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND});
+        this->Attr("reduction").AttrType(OPTIONAL).String("mean");
+        this->Attr("ignore_index").AttrType(OPTIONAL).Int(-100);
+
+        this->SetInferShape(ge::InferShape);
+
+        this->AICore()
+            .SetTiling(optiling::TilingFunc);
+        this->AICore().AddConfig("ascend910b");
+    }
+};
+
+OP_ADD(CrossEntropyLoss);
+}
@@ -0,0 +1,152 @@
+#ifndef LOSS_TILING_COMMON_H
+#define LOSS_TILING_COMMON_H
+
+#include <cstring>
+#include <algorithm>
+#include "register/op_def_registry.h"
+#include "tiling/platform/platform_ascendc.h"
+
+// NLLLoss 与 CrossEntropyLoss 共用的形状解析、多核切分与 workspace 计算
+namespace optiling {
+constexpr uint32_t REDUCTION_NONE = 0;
+constexpr uint32_t REDUCTION_MEAN = 1;
+constexpr uint32_t REDUCTION_SUM = 2;
+// 多核切分样本，部分和经 workspace 合并
+constexpr uint64_t TILING_KEY_MULTI_CORE = 1;
+// 整个问题可一次放入单核 UB：一次搬入、一次向量 gather 规约、标量写回
+constexpr uint64_t TILING_KEY_SINGLE_CORE = 2;
+// 类别数很大时按 target 从 GM 逐个取元素，不搬入整行
+constexpr uint64_t TILING_KEY_ELEMENT_GATHER = 3;
+// 元素数不超过该值时多核切分的启动与同步开销大于收益，1 维 x 的 [C] 场景即落在此路径
+constexpr uint32_t SINGLE_CORE_MAX_ELEMENTS = 8192;
+constexpr uint32_t ALIGN_NUM = 8;
+// 每核在 workspace 中占一个 32B 的槽位，存放 loss 与 weight 的部分和
+constexpr uint32_t SLOT_SIZE = 32;
+// 规约临时空间与跨核合并所需的 UB
+constexpr uint64_t RESERVED_UB = 4 * 1024;
+// LossReducer 每个样本占用的 UB：掩码、weight 偏移与 gather 结果、两组累加和(none 时为双缓冲的输出)、规约空间
+constexpr uint64_t REDUCER_SAMPLE_BYTES = 8 * sizeof(float);
+// 确定性模式下每 8 个样本一个部分和，与核函数一致
+constexpr uint32_t DET_CHUNK = 8;
+// 0 核合并时两级固定长度的树形规约，部分和个数不超过其平方
+constexpr uint32_t DET_TREE_LENGTH = 2048;
+// 每段部分和按一次 repeat 规约，每个 tile 的段数不超过 255
+constexpr uint32_t DET_MAX_TILE_LENGTH = 2040;
+
+struct LossTilingParam {
+    uint32_t n;
+    uint32_t c;
+    uint32_t c_align;
+    uint32_t reduction;
+    int32_t ignore_index;
+    uint32_t block_length;
+    uint32_t tile_length;
+    uint32_t used_core_num;
+    uint64_t tiling_key;
+    bool deterministic;
+};
+
+inline uint32_t CeilDiv(uint32_t value, uint32_t factor)
+{
+    return (value + factor - 1) / factor;
+}
+
+// x 为 [N, C]；x 为 1 维 [C] 时按 N = 1 处理，只取 target[0]
+inline ge::graphStatus ParseLossInput(gert::TilingContext *context, LossTilingParam &param, size_t x_index = 0)
+{
+    const gert::Shape &x_shape = context->GetInputShape(x_index)->GetStorageShape();
+    param.n = 1;
+    param.c = x_shape.GetDim(0);
+    if (x_shape.GetDimNum() == 2) {
+        param.n = x_shape.GetDim(0);
+        param.c = x_shape.GetDim(1);
+    }
+    param.c_align = CeilDiv(param.c, ALIGN_NUM) * ALIGN_NUM;
+
+    const gert::RuntimeAttrs *attrs = context->GetAttrs();
+    const char *reduction = attrs->GetAttrPointer<char>(0);
+    const int64_t *ignore_index = attrs->GetAttrPointer<int64_t>(1);
+    if (strcmp(reduction, "mean") == 0) {
+        param.reduction = REDUCTION_MEAN;
+    } else if (strcmp(reduction, "sum") == 0) {
+        param.reduction = REDUCTION_SUM;
+    } else if (strcmp(reduction, "none") == 0) {
+        param.reduction = REDUCTION_NONE;
+    } else {
+        return ge::GRAPH_FAILED;
+    }
+    param.ignore_index = static_cast<int32_t>(*ignore_index);
+
+    // 由框架的确定性计算开关选择，none 时逐样本输出本身与合并顺序无关
+    param.deterministic = context->GetDeterministic() == 1 && param.reduction != REDUCTION_NONE;
+    if (param.deterministic &&
+        CeilDiv(param.n, DET_CHUNK) > static_cast<uint64_t>(DET_TREE_LENGTH) * DET_TREE_LENGTH) {
+        return ge::GRAPH_FAILED;
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+inline bool IsSingleCore(const LossTilingParam &param)
+{
+    return static_cast<uint64_t>(param.n) * param.c_align <= SINGLE_CORE_MAX_ELEMENTS;
+}
+
+// 按样本数切分到各核，每核样本数按 8 对齐，保证 target 分片 32B 对齐；
+// 再由每个样本占用的 UB 字节数确定每次搬入的样本数
+inline ge::graphStatus SplitLossSamples(gert::TilingContext *context, uint64_t fixed_bytes, uint64_t sample_bytes,
+                                        uint32_t max_tile_length, LossTilingParam &param)
+{
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    param.tiling_key = IsSingleCore(param) ? TILING_KEY_SINGLE_CORE : TILING_KEY_MULTI_CORE;
+    uint32_t core_num = param.tiling_key == TILING_KEY_SINGLE_CORE ? 1 : ascendcPlatform.GetCoreNumAiv();
+    param.block_length = CeilDiv(CeilDiv(param.n, core_num), ALIGN_NUM) * ALIGN_NUM;
+    param.used_core_num = CeilDiv(param.n, param.block_length);
+
+    uint64_t ub_size;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ub_size);
+    fixed_bytes += RESERVED_UB;
+    sample_bytes += REDUCER_SAMPLE_BYTES;
+    if (param.deterministic) {
+        fixed_bytes += 2 * DET_TREE_LENGTH * sizeof(float);
+        max_tile_length = std::min(max_tile_length, DET_MAX_TILE_LENGTH);
+    }
+    if (ub_size <= fixed_bytes + ALIGN_NUM * sample_bytes) {
+        return ge::GRAPH_FAILED;
+    }
+    uint32_t tile_length = (ub_size - fixed_bytes) / sample_bytes / ALIGN_NUM * ALIGN_NUM;
+    param.tile_length = std::min(std::min(tile_length, param.block_length), max_tile_length);
+    return ge::GRAPH_SUCCESS;
+}
+
+inline void SetLossLaunch(gert::TilingContext *context, const LossTilingParam &param)
+{
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    context->SetTilingKey(param.tiling_key);
+    context->SetBlockDim(param.used_core_num);
+    size_t *currentWorkspace = context->GetWorkspaceSizes(1);
+    currentWorkspace[0] = ascendcPlatform.GetLibApiWorkSpaceSize();
+    if (param.deterministic) {
+        // 各段的 loss 与 weight 部分和，单核时同样经 workspace 合并以保证结果一致
+        currentWorkspace[0] += 2 * CeilDiv(CeilDiv(param.n, DET_CHUNK), ALIGN_NUM) * ALIGN_NUM * sizeof(float);
+    } else if (param.tiling_key != TILING_KEY_SINGLE_CORE && param.reduction != REDUCTION_NONE) {
+        currentWorkspace[0] += param.used_core_num * SLOT_SIZE;
+    }
+}
+
+// none 时输出逐样本 loss，形状为 [N]，否则为 [1]
+inline ge::graphStatus InferLossShape(gert::InferShapeContext *context)
+{
+    const gert::Shape *x_shape = context->GetInputShape(0);
+    gert::Shape *y_shape = context->GetOutputShape(0);
+    const char *reduction = context->GetAttrs()->GetAttrPointer<char>(0);
+    y_shape->SetDimNum(1);
+    if (strcmp(reduction, "none") == 0 && x_shape->GetDimNum() == 2) {
+        y_shape->SetDim(0, x_shape->GetDim(0));
+    } else {
+        y_shape->SetDim(0, 1);
+    }
+    return ge::GRAPH_SUCCESS;
+}
+}
+
+#endif // LOSS_TILING_COMMON_H
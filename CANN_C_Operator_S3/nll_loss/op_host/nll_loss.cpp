@@ -0,0 +1,103 @@
+
+#include "nll_loss_tiling.h"
+#include "loss_tiling_common.h"
+
+
+namespace optiling {
+constexpr uint32_t BUFFER_NUM = 2;
+// 一行 x 达到该类别数时，整行搬入只为取一个元素的带宽浪费已远超逐个小块搬运的开销，
+// 改为按 target 从 GM 直接取 x[i, target[i]]
+constexpr uint32_t ELEMENT_GATHER_MIN_C = 2048;
+// 逐元素搬运时每组样本数，限制单次标量下发的搬运指令数
+constexpr uint32_t ELEMENT_GATHER_TILE_LENGTH = 1024;
+constexpr uint32_t BLOCK_SIZE = 32;
+
+static ge::graphStatus TilingFunc(gert::TilingContext* context)
+{
+    NLLLossTilingData tiling;
+    LossTilingParam param;
+    if (ParseLossInput(context, param) != ge::GRAPH_SUCCESS) {
+        return ge::GRAPH_FAILED;
+    }
+    bool element_gather = !IsSingleCore(param) && param.c >= ELEMENT_GATHER_MIN_C;
+    if (element_gather) {
+        // 每个样本在 UB 中需要：x 与 weight 各一个 32B 块以及 target(双缓冲)、块偏移、安全 target 与 x 的 gather 结果，
+        // weight 不常驻 UB
+        uint64_t sample_bytes = BUFFER_NUM * (2 * BLOCK_SIZE + sizeof(int32_t)) + 3 * sizeof(float);
+        if (SplitLossSamples(context, 0, sample_bytes, ELEMENT_GATHER_TILE_LENGTH, param) != ge::GRAPH_SUCCESS) {
+            return ge::GRAPH_FAILED;
+        }
+        param.tiling_key = TILING_KEY_ELEMENT_GATHER;
+    } else {
+        // 每个样本在 UB 中需要：x 的一行与 target(双缓冲)、x 偏移、安全 target 与 x 的 gather 结果、行偏移
+        uint64_t fixed_bytes = param.c_align * sizeof(float);
+        uint64_t sample_bytes = BUFFER_NUM * (param.c_align + 1) * sizeof(float) + 4 * sizeof(float);
+        if (SplitLossSamples(context, fixed_bytes, sample_bytes, param.n, param) != ge::GRAPH_SUCCESS) {
+            return ge::GRAPH_FAILED;
+        }
+    }
+
+    tiling.set_n(param.n);
+    tiling.set_c(param.c);
+    tiling.set_c_align(param.c_align);
+    tiling.set_reduction(param.reduction);
+    tiling.set_ignore_index(param.ignore_index);
+    tiling.set_block_length(param.block_length);
+    tiling.set_tile_length(param.tile_length);
+    tiling.set_used_core_num(param.used_core_num);
+    tiling.set_deterministic(param.deterministic ? 1 : 0);
+
+    SetLossLaunch(context, param);
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+    return ge::GRAPH_SUCCESS;
+}
+}
+
+
+namespace ge {
+static ge::graphStatus InferShape(gert::InferShapeContext* context)
+{
+    return optiling::InferLossShape(context);
+}
+}
+
+
+namespace ops {
+class NLLLoss : public OpDef {
+public:
+    explicit NLLLoss(const char* name) : OpDef(name)
+    {
+        this->Input("x")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND});
+        this->Input("target")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_INT32})
+            .Format({ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND});
+        this->Input("weight")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND});
+        this->Output("y")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND});
+        this->Attr("reduction").AttrType(OPTIONAL).String("mean");
+        this->Attr("ignore_index").AttrType(OPTIONAL).Int(-100);
+
+        this->SetInferShape(ge::InferShape);
+
+        this->AICore()
+            .SetTiling(optiling::TilingFunc);
+        this->AICore().AddConfig("ascend910b");
+    }
+};
+
+OP_ADD(NLLLoss);
+}
@@ -0,0 +1,112 @@
+
+#include "nll_loss_grad_tiling.h"
+#include "loss_tiling_common.h"
+
+
+namespace optiling {
+constexpr uint32_t BUFFER_NUM = 2;
+constexpr uint32_t BLOCK_SIZE = 32;
+// 类别数不超过该值时 weight 整体常驻 UB
+constexpr uint32_t WEIGHT_RESIDENT_MAX_C = 16384;
+// 清零时每次从 UB 搬出的字节数，与核函数一致
+constexpr uint64_t ZERO_BYTES = 32 * 1024;
+// 散写的每个值占一个 32B 块，按行广播的 repeat 次数不超过 255
+constexpr uint32_t MAX_TILE_LENGTH = 1024;
+constexpr uint32_t X_INDEX = 1;
+
+static ge::graphStatus TilingFunc(gert::TilingContext* context)
+{
+    NLLLossGradTilingData tiling;
+    LossTilingParam param;
+    if (ParseLossInput(context, param, X_INDEX) != ge::GRAPH_SUCCESS) {
+        return ge::GRAPH_FAILED;
+    }
+    bool weight_resident = param.c <= WEIGHT_RESIDENT_MAX_C;
+
+    // 每个样本在 UB 中需要：target 与 none 时的 grad_y(双缓冲)、散写值的 32B 块(双缓冲)、
+    // 不常驻时 weight 的 32B 块、块偏移、安全 target、散写值与 weight 累加和
+    uint64_t fixed_bytes = ZERO_BYTES + (weight_resident ? param.c_align * sizeof(float) : 0);
+    uint64_t sample_bytes = BUFFER_NUM * (2 * sizeof(float) + BLOCK_SIZE) + (weight_resident ? 0 : BLOCK_SIZE) +
+                            4 * sizeof(float);
+    if (SplitLossSamples(context, fixed_bytes, sample_bytes, MAX_TILE_LENGTH, param) != ge::GRAPH_SUCCESS) {
+        return ge::GRAPH_FAILED;
+    }
+
+    tiling.set_n(param.n);
+    tiling.set_c(param.c);
+    tiling.set_reduction(param.reduction);
+    tiling.set_ignore_index(param.ignore_index);
+    tiling.set_block_length(param.block_length);
+    tiling.set_tile_length(param.tile_length);
+    tiling.set_used_core_num(param.used_core_num);
+    tiling.set_weight_resident(weight_resident ? 1 : 0);
+
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    context->SetBlockDim(param.used_core_num);
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+    // mean 时各核的 weight 部分和经 workspace 汇总
+    size_t *currentWorkspace = context->GetWorkspaceSizes(1);
+    currentWorkspace[0] = ascendcPlatform.GetLibApiWorkSpaceSize();
+    if (param.reduction == REDUCTION_MEAN) {
+        currentWorkspace[0] += param.used_core_num * SLOT_SIZE;
+    }
+    return ge::GRAPH_SUCCESS;
+}
+}
+
+
+namespace ge {
+static ge::graphStatus InferShape(gert::InferShapeContext* context)
+{
+    const gert::Shape* x_shape = context->GetInputShape(1);
+    gert::Shape* x_grad_shape = context->GetOutputShape(0);
+    *x_grad_shape = *x_shape;
+    return GRAPH_SUCCESS;
+}
+}
+
+
+namespace ops {
+class NLLLossGrad : public OpDef {
+public:
+    explicit NLLLossGrad(const char* name) : OpDef(name)
+    {
+        this->Input("grad_y")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND});
+        this->Input("x")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND});
+        this->Input("target")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_INT32})
+            .Format({ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND});
+        this->Input("weight")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND});
+        this->Output("x_grad")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND});
+        this->Attr("reduction").AttrType(OPTIONAL).String("mean");
+        this->Attr("ignore_index").AttrType(OPTIONAL).Int(-100);
+
+        this->SetInferShape(ge::InferShape);
+
+        this->AICore()
+            .SetTiling(optiling::TilingFunc);
+        this->AICore().AddConfig("ascend910b");
+    }
+};
+
+OP_ADD(NLLLossGrad);
+}
@@ -0,0 +1,21 @@
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(NLLLossGradTilingData)
+  // x 为 [N, C]；x 为 1 维 [C] 时按 N = 1 处理，只取 target[0]
+  TILING_DATA_FIELD_DEF(uint32_t, n);
+  TILING_DATA_FIELD_DEF(uint32_t, c);
+  TILING_DATA_FIELD_DEF(uint32_t, reduction);
+  TILING_DATA_FIELD_DEF(int32_t, ignore_index);
+  // 每核处理的样本数，最后一个核处理剩余部分
+  TILING_DATA_FIELD_DEF(uint32_t, block_length);
+  // 每次搬入 UB 的样本数
+  TILING_DATA_FIELD_DEF(uint32_t, tile_length);
+  TILING_DATA_FIELD_DEF(uint32_t, used_core_num);
+  // weight 是否整体常驻 UB，否则按 target 从 GM 逐个取
+  TILING_DATA_FIELD_DEF(uint32_t, weight_resident);
+END_TILING_DATA_DEF;
+
+REGISTER_TILING_DATA_CLASS(NLLLossGrad, NLLLossGradTilingData)
+}
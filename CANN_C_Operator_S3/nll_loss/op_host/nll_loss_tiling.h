@@ -0,0 +1,23 @@
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(NLLLossTilingData)
+  // x 为 [N, C]；x 为 1 维 [C] 时按 N = 1 处理，只取 target[0]
+  TILING_DATA_FIELD_DEF(uint32_t, n);
+  TILING_DATA_FIELD_DEF(uint32_t, c);
+  // 每行在 UB 中按 32B 对齐后的元素个数
+  TILING_DATA_FIELD_DEF(uint32_t, c_align);
+  TILING_DATA_FIELD_DEF(uint32_t, reduction);
+  TILING_DATA_FIELD_DEF(int32_t, ignore_index);
+  // 每核处理的样本数，最后一个核处理剩余部分
+  TILING_DATA_FIELD_DEF(uint32_t, block_length);
+  // 每次搬入 UB 的样本数
+  TILING_DATA_FIELD_DEF(uint32_t, tile_length);
+  TILING_DATA_FIELD_DEF(uint32_t, used_core_num);
+  // 确定性模式：部分和按固定的样本分段与树形顺序合并，结果与核数无关
+  TILING_DATA_FIELD_DEF(uint32_t, deterministic);
+END_TILING_DATA_DEF;
+
+REGISTER_TILING_DATA_CLASS(NLLLoss, NLLLossTilingData)
+}
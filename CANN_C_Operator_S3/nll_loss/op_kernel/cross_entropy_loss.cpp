@@ -0,0 +1,301 @@
+#include "nll_loss_common.h"
+
+// 列方向按 64 个 float 一组折叠，再对每行做整组规约
+constexpr uint32_t FOLD_LENGTH = 64;
+// 块尾填充值，减去行最大值后取指数为 0
+constexpr float LOWEST_FLOAT = -3.40282347e+38f;
+
+// logits 只读一次：按类别分块搬入，每块内求行最大值与指数和，跨块做在线 log-sum-exp，
+// 同时取出 target 所在类别的 logit，loss = lse - x[t] 交给 LossReducer 做加权与规约
+template <bool SINGLE_CORE>
+class KernelCrossEntropyLoss {
+public:
+    __aicore__ inline KernelCrossEntropyLoss() {}
+
+    // 初始化
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR target, GM_ADDR weight, GM_ADDR y, GM_ADDR workspace,
+                                const CrossEntropyLossTilingData &tilingData, TPipe *pipeIn)
+    {
+        pipe = pipeIn;
+        c = tilingData.c;
+        ignoreIndex = tilingData.ignore_index;
+        weightResident = tilingData.weight_resident != 0;
+        chunkLength = tilingData.chunk_length;
+        tileLength = tilingData.tile_length;
+        uint32_t start = GetBlockIdx() * tilingData.block_length;
+        length = tilingData.n - start < tilingData.block_length ? tilingData.n - start : tilingData.block_length;
+        reducer.Init(pipe, weight, y, workspace, tilingData, start, length, weightResident);
+        tileAlign = reducer.TileAlign();
+
+        xGlobal.SetGlobalBuffer((__gm__ float *)x + static_cast<uint64_t>(start) * c,
+                                static_cast<uint64_t>(length) * c);
+        targetGlobal.SetGlobalBuffer((__gm__ int32_t *)target + start, length);
+
+        pipe->InitBuffer(xQueue, BUFFER_NUM, tileLength * chunkLength * sizeof(float));
+        pipe->InitBuffer(targetQueue, BUFFER_NUM, tileAlign * sizeof(int32_t));
+        pipe->InitBuffer(foldBuf, tileLength * FOLD_LENGTH * sizeof(float));
+        pipe->InitBuffer(brcbBuf, tileAlign * BLOCK_FLOAT * sizeof(float));
+        pipe->InitBuffer(statBuf, STAT_NUM * tileAlign * sizeof(float));
+        pipe->InitBuffer(offsetBuf, tileAlign * sizeof(int32_t));
+        pipe->InitBuffer(rowBaseBuf, tileAlign * sizeof(float));
+        pipe->InitBuffer(hitMaskBuf, 2 * tileAlign);
+        // weight 不常驻时每个样本的 weight 占一个 32B 块，再按块偏移 gather 成连续向量
+        if (!weightResident) {
+            pipe->InitBuffer(weightSlotQueue, 1, tileAlign * ONE_BLK_SIZE);
+            pipe->InitBuffer(slotOffsetBuf, tileAlign * sizeof(int32_t));
+        }
+    }
+
+    // 计算过程：各核先得到本核的 loss 与 weight 部分和，再经 workspace 由 0 核合并；
+    // none 时逐 tile 写回每个样本的 loss
+    __aicore__ inline void Process()
+    {
+        reducer.LoadWeight();
+        // 第 i 行在 x 块中的字节偏移，各 tile 共用
+        LocalTensor<float> rowBase = rowBaseBuf.Get<float>();
+        ArithProgression<float>(rowBase, 0.0f, static_cast<float>(chunkLength * sizeof(float)), tileAlign);
+        if (!weightResident) {
+            LocalTensor<int32_t> slotOffset = slotOffsetBuf.Get<int32_t>();
+            ArithProgression<int32_t>(slotOffset, 0, static_cast<int32_t>(ONE_BLK_SIZE), tileAlign);
+        }
+
+        uint32_t tileNum = CeilDiv(length, tileLength);
+        uint32_t chunkNum = CeilDiv(c, chunkLength);
+        for (uint32_t i = 0; i < tileNum; i++) {
+            uint32_t count = i == tileNum - 1 ? length - i * tileLength : tileLength;
+            PrepareTile(i, count);
+            for (uint32_t j = 0; j < chunkNum; j++) {
+                uint32_t chunkStart = j * chunkLength;
+                uint32_t width = j == chunkNum - 1 ? c - chunkStart : chunkLength;
+                CopyIn(i, count, chunkStart, width);
+                Compute(count, chunkStart, width);
+            }
+            FinishTile(i, count);
+        }
+        reducer.template Finish<SINGLE_CORE>();
+    }
+
+private:
+    // 搬入 target 生成安全的类别下标，并重置行统计量
+    __aicore__ inline void PrepareTile(uint32_t progress, uint32_t count)
+    {
+        LocalTensor<int32_t> targetLocal = targetQueue.AllocTensor<int32_t>();
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(count * sizeof(int32_t)), 0, 0, 0};
+        DataCopyPadExtParams<int32_t> padParams{false, 0, 0, 0};
+        DataCopyPad(targetLocal, targetGlobal[progress * tileLength], copyParams, padParams);
+        targetQueue.EnQue(targetLocal);
+        targetLocal = targetQueue.DeQue<int32_t>();
+        if (!weightResident) {
+            GatherWeight(targetLocal, count);
+        }
+        reducer.Prepare(targetLocal, Stat(TARGET), count);
+        targetQueue.FreeTensor(targetLocal);
+
+        Duplicate(Stat(ROW_MAX), LOWEST_FLOAT, tileAlign);
+        Duplicate(Stat(ROW_SUM), 0.0f, tileAlign);
+        Duplicate(Stat(X_TARGET), 0.0f, tileAlign);
+    }
+
+    // 按 target 从 GM 逐个取 weight 写入 reducer 的 gather 结果；ignore 或越界的 target 取第 0 类只为保证地址合法，
+    // 其 weight 由 Prepare 的掩码清零
+    __aicore__ inline void GatherWeight(const LocalTensor<int32_t> &targetLocal, uint32_t count)
+    {
+        WaitPipe<HardEvent::MTE2_S>(pipe);
+        LocalTensor<float> slotLocal = weightSlotQueue.AllocTensor<float>();
+        GlobalTensor<float> weightGlobal = reducer.WeightGlobal();
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(sizeof(float)), 0, 0, 0};
+        DataCopyPadExtParams<float> padParams{false, 0, 0, 0};
+        for (uint32_t r = 0; r < count; r++) {
+            int32_t t = targetLocal.GetValue(r);
+            if (t == ignoreIndex || t < 0 || t >= static_cast<int32_t>(c)) {
+                t = 0;
+            }
+            DataCopyPad(slotLocal[r * BLOCK_FLOAT], weightGlobal[t], copyParams, padParams);
+        }
+        weightSlotQueue.EnQue(slotLocal);
+        slotLocal = weightSlotQueue.DeQue<float>();
+        Gather(reducer.GatheredWeight(), slotLocal, slotOffsetBuf.Get<uint32_t>(), 0, count);
+        weightSlotQueue.FreeTensor(slotLocal);
+    }
+
+    // 每行搬入 width 个类别，UB 内按 chunkLength 对齐存放
+    __aicore__ inline void CopyIn(uint32_t progress, uint32_t count, uint32_t chunkStart, uint32_t width)
+    {
+        LocalTensor<float> xLocal = xQueue.AllocTensor<float>();
+        uint32_t widthAlign = CeilDiv(width, BLOCK_FLOAT) * BLOCK_FLOAT;
+        DataCopyExtParams copyParams{static_cast<uint16_t>(count), static_cast<uint32_t>(width * sizeof(float)),
+                                     static_cast<uint32_t>((c - width) * sizeof(float)),
+                                     (chunkLength - widthAlign) / BLOCK_FLOAT, 0};
+        DataCopyPadExtParams<float> padParams{false, 0, 0, 0};
+        DataCopyPad(xLocal, xGlobal[static_cast<uint64_t>(progress) * tileLength * c + chunkStart], copyParams, padParams);
+        xQueue.EnQue(xLocal);
+    }
+
+    __aicore__ inline void Compute(uint32_t count, uint32_t chunkStart, uint32_t width)
+    {
+        LocalTensor<float> xLocal = xQueue.DeQue<float>();
+        uint8_t rowStride = chunkLength / BLOCK_FLOAT;
+        if (width < chunkLength) {
+            PadTail(xLocal, count, width, rowStride);
+        }
+        GatherTarget(xLocal, count, chunkStart, width);
+
+        // 块内行最大值，并更新在线最大值：rowSum *= exp(rowMax - newMax)
+        LocalTensor<float> rowMax = Stat(ROW_MAX);
+        LocalTensor<float> rowSum = Stat(ROW_SUM);
+        LocalTensor<float> chunkStat = Stat(CHUNK);
+        LocalTensor<float> newMax = Stat(TEMP);
+        FoldRows<true>(xLocal, count, rowStride);
+        Max(newMax, rowMax, chunkStat, count);
+        Sub(chunkStat, rowMax, newMax, count);
+        Exp(chunkStat, chunkStat, count);
+        Mul(rowSum, rowSum, chunkStat, count);
+        Adds(rowMax, newMax, 0.0f, count);
+
+        // 行最大值广播为每行一个 32B 块，按块跨度 0 减到每一列上
+        LocalTensor<float> brcbLocal = brcbBuf.Get<float>();
+        Brcb(brcbLocal, rowMax, static_cast<uint8_t>(tileAlign / BLOCK_FLOAT), {1, BLOCK_FLOAT});
+        for (uint32_t k = 0; k < chunkLength; k += FOLD_LENGTH) {
+            Sub(xLocal[k], xLocal[k], brcbLocal, FOLD_LENGTH, count, {1, 1, 0, rowStride, rowStride, 1});
+        }
+        Exp(xLocal, xLocal, count * chunkLength);
+        FoldRows<false>(xLocal, count, rowStride);
+        Add(rowSum, rowSum, chunkStat, count);
+
+        xQueue.FreeTensor(xLocal);
+    }
+
+    // 最后一块不足 chunkLength 的列填充为极小值，不影响最大值与指数和
+    __aicore__ inline void PadTail(const LocalTensor<float> &xLocal, uint32_t count, uint32_t width,
+                                   uint8_t rowStride)
+    {
+        uint32_t k = width / FOLD_LENGTH * FOLD_LENGTH;
+        uint32_t head = width - k;
+        if (head != 0) {
+            uint64_t mask[2] = {~((static_cast<uint64_t>(1) << head) - 1), 0};
+            Duplicate(xLocal[k], LOWEST_FLOAT, mask, static_cast<uint8_t>(count), 1, rowStride);
+            k += FOLD_LENGTH;
+        }
+        uint64_t fullMask[2] = {~static_cast<uint64_t>(0), 0};
+        for (; k < chunkLength; k += FOLD_LENGTH) {
+            Duplicate(xLocal[k], LOWEST_FLOAT, fullMask, static_cast<uint8_t>(count), 1, rowStride);
+        }
+    }
+
+    // target 落在本块 [chunkStart, chunkStart + width) 内的行取出原始 logit，其余行的命中掩码为 0
+    __aicore__ inline void GatherTarget(const LocalTensor<float> &xLocal, uint32_t count, uint32_t chunkStart,
+                                        uint32_t width)
+    {
+        uint32_t cmpCount = CeilDiv(count, CMP_ALIGN) * CMP_ALIGN;
+        LocalTensor<float> localTarget = Stat(LOCAL_TARGET);
+        LocalTensor<float> hit = Stat(HIT);
+        LocalTensor<float> xGather = Stat(GATHER);
+        LocalTensor<uint8_t> geMask = hitMaskBuf.Get<uint8_t>();
+        LocalTensor<uint8_t> ltMask = geMask[tileAlign];
+        Adds(localTarget, Stat(TARGET), -static_cast<float>(chunkStart), cmpCount);
+        CompareScalar(geMask, localTarget, 0.0f, CMPMODE::GE, cmpCount);
+        CompareScalar(ltMask, localTarget, static_cast<float>(width), CMPMODE::LT, cmpCount);
+        Duplicate(hit, 1.0f, cmpCount);
+        Select(hit, geMask, hit, 0.0f, SELMODE::VSEL_TENSOR_SCALAR_MODE, cmpCount);
+        Select(hit, ltMask, hit, 0.0f, SELMODE::VSEL_TENSOR_SCALAR_MODE, cmpCount);
+
+        LocalTensor<int32_t> xOffset = offsetBuf.Get<int32_t>();
+        Mul(localTarget, localTarget, hit, count);
+        Muls(localTarget, localTarget, static_cast<float>(sizeof(float)), count);
+        Add(localTarget, localTarget, rowBaseBuf.Get<float>(), count);
+        Cast(xOffset, localTarget, RoundMode::CAST_RINT, count);
+        Gather(xGather, xLocal, xOffset.ReinterpretCast<uint32_t>(), 0, count);
+        Mul(xGather, xGather, hit, count);
+        Add(Stat(X_TARGET), Stat(X_TARGET), xGather, count);
+    }
+
+    // 各行的 chunkLength 列先按 64 列一组逐组折叠，再整组规约得到每行一个值，结果写入块统计量
+    template <bool IS_MAX>
+    __aicore__ inline void FoldRows(const LocalTensor<float> &xLocal, uint32_t count, uint8_t rowStride)
+    {
+        LocalTensor<float> foldLocal = foldBuf.Get<float>();
+        uint8_t repeat = static_cast<uint8_t>(count);
+        Adds(foldLocal, xLocal, 0.0f, FOLD_LENGTH, repeat, {1, 1, BLOCK_FLOAT, rowStride});
+        for (uint32_t k = FOLD_LENGTH; k < chunkLength; k += FOLD_LENGTH) {
+            if constexpr (IS_MAX) {
+                Max(foldLocal, foldLocal, xLocal[k], FOLD_LENGTH, repeat, {1, 1, 1, BLOCK_FLOAT, BLOCK_FLOAT, rowStride});
+            } else {
+                Add(foldLocal, foldLocal, xLocal[k], FOLD_LENGTH, repeat, {1, 1, 1, BLOCK_FLOAT, BLOCK_FLOAT, rowStride});
+            }
+        }
+        if constexpr (IS_MAX) {
+            WholeReduceMax(Stat(CHUNK), foldLocal, FOLD_LENGTH, count, 1, 1, BLOCK_FLOAT, ReduceOrder::ORDER_ONLY_VALUE);
+        } else {
+            WholeReduceSum(Stat(CHUNK), foldLocal, FOLD_LENGTH, count, 1, 1, BLOCK_FLOAT);
+        }
+    }
+
+    // loss = max + log(sum) - x[t]
+    __aicore__ inline void FinishTile(uint32_t progress, uint32_t count)
+    {
+        LocalTensor<float> loss = Stat(ROW_SUM);
+        Ln(loss, loss, count);
+        Add(loss, loss, Stat(ROW_MAX), count);
+        Sub(loss, loss, Stat(X_TARGET), count);
+        reducer.Accumulate(loss, progress, count);
+    }
+
+    __aicore__ inline LocalTensor<float> Stat(uint32_t index)
+    {
+        return statBuf.Get<float>()[index * tileAlign];
+    }
+
+private:
+    // statBuf 中各行统计量的位置
+    enum StatIndex : uint32_t {
+        ROW_MAX = 0,
+        ROW_SUM,
+        CHUNK,
+        TEMP,
+        X_TARGET,
+        TARGET,
+        LOCAL_TARGET,
+        HIT,
+        GATHER,
+        STAT_NUM
+    };
+
+    TPipe *pipe;
+    LossReducer reducer;
+    TQue<QuePosition::VECIN, BUFFER_NUM> xQueue;
+    TQue<QuePosition::VECIN, BUFFER_NUM> targetQueue;
+    TQue<QuePosition::VECIN, 1> weightSlotQueue;
+    TBuf<QuePosition::VECCALC> foldBuf;
+    TBuf<QuePosition::VECCALC> brcbBuf;
+    TBuf<QuePosition::VECCALC> statBuf;
+    TBuf<QuePosition::VECCALC> offsetBuf;
+    TBuf<QuePosition::VECCALC> rowBaseBuf;
+    TBuf<QuePosition::VECCALC> hitMaskBuf;
+    TBuf<QuePosition::VECCALC> slotOffsetBuf;
+
+    GlobalTensor<float> xGlobal;
+    GlobalTensor<int32_t> targetGlobal;
+
+    uint32_t c;
+    int32_t ignoreIndex;
+    bool weightResident;
+    uint32_t chunkLength;
+    uint32_t tileLength;
+    uint32_t tileAlign;
+    uint32_t length;
+};
+
+extern "C" __global__ __aicore__ void cross_entropy_loss(GM_ADDR x, GM_ADDR target, GM_ADDR weight, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling) {
+    GET_TILING_DATA(tiling_data, tiling);
+    GM_ADDR usrWorkspace = GetUserWorkspace(workspace);
+    TPipe pipe;
+    if (TILING_KEY_IS(1)) {
+        KernelCrossEntropyLoss<false> op;
+        op.Init(x, target, weight, y, usrWorkspace, tiling_data, &pipe);
+        op.Process();
+    } else if (TILING_KEY_IS(2)) {
+        KernelCrossEntropyLoss<true> op;
+        op.Init(x, target, weight, y, usrWorkspace, tiling_data, &pipe);
+        op.Process();
+    }
+}
@@ -0,0 +1,232 @@
+#include "nll_loss_common.h"
+
+// SINGLE_CORE：整个问题一次搬入单核 UB，部分和即最终结果，省去 workspace 往返与核间同步
+template <bool SINGLE_CORE>
+class KernelNLLLoss {
+public:
+    __aicore__ inline KernelNLLLoss() {}
+
+    // 初始化
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR target, GM_ADDR weight, GM_ADDR y, GM_ADDR workspace,
+                                const NLLLossTilingData &tilingData, TPipe *pipeIn)
+    {
+        pipe = pipeIn;
+        c = tilingData.c;
+        cAlign = tilingData.c_align;
+        tileLength = tilingData.tile_length;
+        uint32_t start = GetBlockIdx() * tilingData.block_length;
+        length = tilingData.n - start < tilingData.block_length ? tilingData.n - start : tilingData.block_length;
+        reducer.Init(pipe, weight, y, workspace, tilingData, start, length);
+        tileAlign = reducer.TileAlign();
+
+        xGlobal.SetGlobalBuffer((__gm__ float *)x + start * c, length * c);
+        targetGlobal.SetGlobalBuffer((__gm__ int32_t *)target + start, length);
+
+        pipe->InitBuffer(xQueue, BUFFER_NUM, tileLength * cAlign * sizeof(float));
+        pipe->InitBuffer(targetQueue, BUFFER_NUM, tileAlign * sizeof(int32_t));
+        pipe->InitBuffer(offsetBuf, tileAlign * sizeof(int32_t));
+        pipe->InitBuffer(gatherBuf, 2 * tileAlign * sizeof(float));
+        pipe->InitBuffer(rowBaseBuf, tileAlign * sizeof(float));
+    }
+
+    // 计算过程：各核先得到本核的 loss 与 weight 部分和，再经 workspace 由 0 核合并；
+    // none 时逐 tile 写回每个样本的 loss
+    __aicore__ inline void Process()
+    {
+        reducer.LoadWeight();
+        // 第 i 行在 x tile 中的字节偏移，各 tile 共用
+        LocalTensor<float> rowBase = rowBaseBuf.Get<float>();
+        ArithProgression<float>(rowBase, 0.0f, static_cast<float>(cAlign * sizeof(float)), tileAlign);
+
+        uint32_t tileNum = CeilDiv(length, tileLength);
+        for (uint32_t i = 0; i < tileNum; i++) {
+            uint32_t count = i == tileNum - 1 ? length - i * tileLength : tileLength;
+            CopyIn(i, count);
+            Compute(i, count);
+        }
+        reducer.template Finish<SINGLE_CORE>();
+    }
+
+private:
+    __aicore__ inline void CopyIn(uint32_t progress, uint32_t count)
+    {
+        LocalTensor<float> xLocal = xQueue.AllocTensor<float>();
+        LocalTensor<int32_t> targetLocal = targetQueue.AllocTensor<int32_t>();
+        // 每行按 cAlign 对齐存放，行内偏移即 target
+        DataCopyExtParams xParams{static_cast<uint16_t>(count), static_cast<uint32_t>(c * sizeof(float)), 0, 0, 0};
+        DataCopyPadExtParams<float> xPadParams{false, 0, 0, 0};
+        DataCopyPad(xLocal, xGlobal[progress * tileLength * c], xParams, xPadParams);
+        DataCopyExtParams targetParams{1, static_cast<uint32_t>(count * sizeof(int32_t)), 0, 0, 0};
+        DataCopyPadExtParams<int32_t> targetPadParams{false, 0, 0, 0};
+        DataCopyPad(targetLocal, targetGlobal[progress * tileLength], targetParams, targetPadParams);
+        xQueue.EnQue(xLocal);
+        targetQueue.EnQue(targetLocal);
+    }
+
+    __aicore__ inline void Compute(uint32_t progress, uint32_t count)
+    {
+        LocalTensor<float> xLocal = xQueue.DeQue<float>();
+        LocalTensor<int32_t> targetLocal = targetQueue.DeQue<int32_t>();
+        LocalTensor<float> targetFloat = gatherBuf.Get<float>();
+        LocalTensor<float> xGather = targetFloat[tileAlign];
+        reducer.Prepare(targetLocal, targetFloat, count);
+
+        LocalTensor<float> rowBase = rowBaseBuf.Get<float>();
+        LocalTensor<int32_t> xOffset = offsetBuf.Get<int32_t>();
+        Muls(targetFloat, targetFloat, static_cast<float>(sizeof(float)), count);
+        Add(targetFloat, targetFloat, rowBase, count);
+        Cast(xOffset, targetFloat, RoundMode::CAST_RINT, count);
+        Gather(xGather, xLocal, xOffset.ReinterpretCast<uint32_t>(), 0, count);
+        Muls(xGather, xGather, -1.0f, count);
+        reducer.Accumulate(xGather, progress, count);
+
+        xQueue.FreeTensor(xLocal);
+        targetQueue.FreeTensor(targetLocal);
+    }
+
+private:
+    TPipe *pipe;
+    LossReducer reducer;
+    TQue<QuePosition::VECIN, BUFFER_NUM> xQueue;
+    TQue<QuePosition::VECIN, BUFFER_NUM> targetQueue;
+    TBuf<QuePosition::VECCALC> offsetBuf;
+    TBuf<QuePosition::VECCALC> gatherBuf;
+    TBuf<QuePosition::VECCALC> rowBaseBuf;
+
+    GlobalTensor<float> xGlobal;
+    GlobalTensor<int32_t> targetGlobal;
+
+    uint32_t c;
+    uint32_t cAlign;
+    uint32_t tileLength;
+    uint32_t tileAlign;
+    uint32_t length;
+};
+
+// 类别数很大时一行 x 放不进 UB，且每个样本只需要 x[i, target[i]]：
+// 按 target 直接从 GM 逐个取出 x 与 weight 的一个元素，各占一个 32B 块，凑满一组后 gather 成连续向量，
+// 搬运量只与 N 相关而与 C 无关
+class KernelNLLLossGather {
+public:
+    __aicore__ inline KernelNLLLossGather() {}
+
+    // 初始化
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR target, GM_ADDR weight, GM_ADDR y, GM_ADDR workspace,
+                                const NLLLossTilingData &tilingData, TPipe *pipeIn)
+    {
+        pipe = pipeIn;
+        c = tilingData.c;
+        ignoreIndex = tilingData.ignore_index;
+        tileLength = tilingData.tile_length;
+        uint32_t start = GetBlockIdx() * tilingData.block_length;
+        length = tilingData.n - start < tilingData.block_length ? tilingData.n - start : tilingData.block_length;
+        reducer.Init(pipe, weight, y, workspace, tilingData, start, length, false);
+        tileAlign = reducer.TileAlign();
+
+        xGlobal.SetGlobalBuffer((__gm__ float *)x + static_cast<uint64_t>(start) * c,
+                                static_cast<uint64_t>(length) * c);
+        targetGlobal.SetGlobalBuffer((__gm__ int32_t *)target + start, length);
+
+        pipe->InitBuffer(targetQueue, BUFFER_NUM, tileAlign * sizeof(int32_t));
+        // 前半存放 x 的元素，后半存放 weight 的元素，每个样本占一个 32B 块
+        pipe->InitBuffer(slotQueue, BUFFER_NUM, 2 * tileAlign * ONE_BLK_SIZE);
+        pipe->InitBuffer(slotOffsetBuf, tileAlign * sizeof(int32_t));
+        pipe->InitBuffer(gatherBuf, 2 * tileAlign * sizeof(float));
+    }
+
+    __aicore__ inline void Process()
+    {
+        reducer.LoadWeight();
+        LocalTensor<int32_t> slotOffset = slotOffsetBuf.Get<int32_t>();
+        ArithProgression<int32_t>(slotOffset, 0, static_cast<int32_t>(ONE_BLK_SIZE), tileAlign);
+
+        uint32_t tileNum = CeilDiv(length, tileLength);
+        for (uint32_t i = 0; i < tileNum; i++) {
+            uint32_t count = i == tileNum - 1 ? length - i * tileLength : tileLength;
+            CopyIn(i, count);
+            Compute(i, count);
+        }
+        reducer.template Finish<false>();
+    }
+
+private:
+    __aicore__ inline void CopyIn(uint32_t progress, uint32_t count)
+    {
+        LocalTensor<int32_t> targetLocal = targetQueue.AllocTensor<int32_t>();
+        DataCopyExtParams targetParams{1, static_cast<uint32_t>(count * sizeof(int32_t)), 0, 0, 0};
+        DataCopyPadExtParams<int32_t> targetPadParams{false, 0, 0, 0};
+        DataCopyPad(targetLocal, targetGlobal[progress * tileLength], targetParams, targetPadParams);
+        WaitPipe<HardEvent::MTE2_S>(pipe);
+
+        // ignore 或越界的 target 取第 0 类只为保证地址合法，Prepare 对这两类样本同样生成 0 掩码，weight 被清零后不计入 loss
+        LocalTensor<float> slotLocal = slotQueue.AllocTensor<float>();
+        GlobalTensor<float> weightGlobal = reducer.WeightGlobal();
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(sizeof(float)), 0, 0, 0};
+        DataCopyPadExtParams<float> padParams{false, 0, 0, 0};
+        uint64_t rowOffset = static_cast<uint64_t>(progress) * tileLength * c;
+        for (uint32_t r = 0; r < count; r++) {
+            int32_t t = targetLocal.GetValue(r);
+            if (t == ignoreIndex || t < 0 || t >= static_cast<int32_t>(c)) {
+                t = 0;
+            }
+            DataCopyPad(slotLocal[r * BLOCK_FLOAT], xGlobal[rowOffset + t], copyParams, padParams);
+            DataCopyPad(slotLocal[(tileAlign + r) * BLOCK_FLOAT], weightGlobal[t], copyParams, padParams);
+            rowOffset += c;
+        }
+        targetQueue.EnQue(targetLocal);
+        slotQueue.EnQue(slotLocal);
+    }
+
+    __aicore__ inline void Compute(uint32_t progress, uint32_t count)
+    {
+        LocalTensor<int32_t> targetLocal = targetQueue.DeQue<int32_t>();
+        LocalTensor<float> slotLocal = slotQueue.DeQue<float>();
+        LocalTensor<uint32_t> slotOffset = slotOffsetBuf.Get<uint32_t>();
+        LocalTensor<float> targetFloat = gatherBuf.Get<float>();
+        LocalTensor<float> xGather = targetFloat[tileAlign];
+        Gather(xGather, slotLocal, slotOffset, 0, count);
+        Gather(reducer.GatheredWeight(), slotLocal[tileAlign * BLOCK_FLOAT], slotOffset, 0, count);
+        reducer.Prepare(targetLocal, targetFloat, count);
+        Muls(xGather, xGather, -1.0f, count);
+        reducer.Accumulate(xGather, progress, count);
+
+        targetQueue.FreeTensor(targetLocal);
+        slotQueue.FreeTensor(slotLocal);
+    }
+
+private:
+    TPipe *pipe;
+    LossReducer reducer;
+    TQue<QuePosition::VECIN, BUFFER_NUM> targetQueue;
+    TQue<QuePosition::VECIN, BUFFER_NUM> slotQueue;
+    TBuf<QuePosition::VECCALC> slotOffsetBuf;
+    TBuf<QuePosition::VECCALC> gatherBuf;
+
+    GlobalTensor<float> xGlobal;
+    GlobalTensor<int32_t> targetGlobal;
+
+    uint32_t c;
+    int32_t ignoreIndex;
+    uint32_t tileLength;
+    uint32_t tileAlign;
+    uint32_t length;
+};
+
+extern "C" __global__ __aicore__ void nll_loss(GM_ADDR x, GM_ADDR target, GM_ADDR weight, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling) {
+    GET_TILING_DATA(tiling_data, tiling);
+    GM_ADDR usrWorkspace = GetUserWorkspace(workspace);
+    TPipe pipe;
+    if (TILING_KEY_IS(1)) {
+        KernelNLLLoss<false> op;
+        op.Init(x, target, weight, y, usrWorkspace, tiling_data, &pipe);
+        op.Process();
+    } else if (TILING_KEY_IS(2)) {
+        KernelNLLLoss<true> op;
+        op.Init(x, target, weight, y, usrWorkspace, tiling_data, &pipe);
+        op.Process();
+    } else if (TILING_KEY_IS(3)) {
+        KernelNLLLossGather op;
+        op.Init(x, target, weight, y, usrWorkspace, tiling_data, &pipe);
+        op.Process();
+    }
+}
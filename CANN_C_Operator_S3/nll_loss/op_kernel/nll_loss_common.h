@@ -0,0 +1,403 @@
+#ifndef NLL_LOSS_COMMON_H
+#define NLL_LOSS_COMMON_H
+
+#include "kernel_operator.h"
+using namespace AscendC;
+
+constexpr int32_t BUFFER_NUM = 2;
+constexpr uint32_t REDUCTION_NONE = 0;
+constexpr uint32_t REDUCTION_MEAN = 1;
+// Compare 每次处理 256B，按 float 个数对齐
+constexpr uint32_t CMP_ALIGN = 64;
+// 每个 32B 块的 float 个数
+constexpr uint32_t BLOCK_FLOAT = 8;
+// 每核在 workspace 中的槽位：[0] 为 loss 部分和，[1] 为 weight 部分和
+constexpr uint32_t SLOT_NUM = 8;
+// 确定性模式下每 8 个样本求一个部分和，按样本位置写入 workspace，结果与核数、tile 切分无关
+constexpr uint32_t DET_CHUNK = 8;
+// 部分和按该长度分块做固定形状的两两规约，再对各块结果做同样的规约
+constexpr uint32_t DET_TREE_LENGTH = 2048;
+
+__aicore__ inline uint32_t CeilDiv(uint32_t value, uint32_t factor)
+{
+    return (value + factor - 1) / factor;
+}
+
+template <HardEvent EVENT>
+__aicore__ inline void WaitPipe(TPipe *pipe)
+{
+    event_t eventId = static_cast<event_t>(pipe->FetchEventID(EVENT));
+    SetFlag<EVENT>(eventId);
+    WaitFlag<EVENT>(eventId);
+}
+
+// 按 target 取 weight 并生成有效掩码（ignore 与越界的 target 均无效），NLLLoss 前向与反向共用
+class WeightGather {
+public:
+    __aicore__ inline WeightGather() {}
+
+    __aicore__ inline void Init(TPipe *pipe, GM_ADDR weight, uint32_t c, int32_t ignoreIndexIn, uint32_t tileAlignIn,
+                                bool residentIn)
+    {
+        cLength = c;
+        ignoreIndex = ignoreIndexIn;
+        tileAlign = tileAlignIn;
+        resident = residentIn;
+        weightGlobal.SetGlobalBuffer((__gm__ float *)weight, c);
+        if (resident) {
+            pipe->InitBuffer(weightQueue, 1, CeilDiv(c, BLOCK_FLOAT) * BLOCK_FLOAT * sizeof(float));
+        }
+        // 前半为 0/1 权重掩码，后半为 Compare 输出的位掩码
+        pipe->InitBuffer(maskBuf, tileAlign * sizeof(float) + tileAlign);
+        pipe->InitBuffer(wOffsetBuf, tileAlign * sizeof(int32_t));
+        pipe->InitBuffer(wGatherBuf, tileAlign * sizeof(float));
+    }
+
+    // weight 只有 C 个元素，整体常驻 UB，按 target 做向量 gather；
+    // 不常驻时由调用方按 target 从 GM 逐个取出并写入 Gathered()
+    __aicore__ inline void Load()
+    {
+        if (!resident) {
+            return;
+        }
+        LocalTensor<float> local = weightQueue.AllocTensor<float>();
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(cLength * sizeof(float)), 0, 0, 0};
+        DataCopyPadExtParams<float> padParams{false, 0, 0, 0};
+        DataCopyPad(local, weightGlobal, copyParams, padParams);
+        weightQueue.EnQue(local);
+        weightLocal = weightQueue.DeQue<float>();
+    }
+
+    __aicore__ inline void Free()
+    {
+        if (resident) {
+            weightQueue.FreeTensor(weightLocal);
+        }
+    }
+
+    __aicore__ inline GlobalTensor<float> Global() const
+    {
+        return weightGlobal;
+    }
+
+    __aicore__ inline LocalTensor<float> Gathered()
+    {
+        return wGatherBuf.Get<float>();
+    }
+
+    // 向量比较生成有效掩码：target 不等于 ignore_index 且落在 [0, C) 内的样本权重乘 1，
+    // 其余样本乘 0 且 target 替换为 0 防止 gather 越界。targetFloat 输出安全的 target，weight 按其 gather 后乘以掩码
+    __aicore__ inline void Prepare(const LocalTensor<int32_t> &targetLocal, const LocalTensor<float> &targetFloat,
+                                   uint32_t count)
+    {
+        uint32_t cmpCount = CeilDiv(count, CMP_ALIGN) * CMP_ALIGN;
+        LocalTensor<float> validLocal = maskBuf.Get<float>();
+        LocalTensor<uint8_t> maskLocal = validLocal[tileAlign].ReinterpretCast<uint8_t>();
+        Cast(targetFloat, targetLocal, RoundMode::CAST_NONE, cmpCount);
+        Duplicate(validLocal, 1.0f, cmpCount);
+        CompareScalar(maskLocal, targetFloat, static_cast<float>(ignoreIndex), CMPMODE::NE, cmpCount);
+        Select(validLocal, maskLocal, validLocal, 0.0f, SELMODE::VSEL_TENSOR_SCALAR_MODE, cmpCount);
+        CompareScalar(maskLocal, targetFloat, 0.0f, CMPMODE::GE, cmpCount);
+        Select(validLocal, maskLocal, validLocal, 0.0f, SELMODE::VSEL_TENSOR_SCALAR_MODE, cmpCount);
+        CompareScalar(maskLocal, targetFloat, static_cast<float>(cLength), CMPMODE::LT, cmpCount);
+        Select(validLocal, maskLocal, validLocal, 0.0f, SELMODE::VSEL_TENSOR_SCALAR_MODE, cmpCount);
+        Mul(targetFloat, targetFloat, validLocal, cmpCount);
+
+        // 偏移在 float 下计算，UB 内的字节偏移远小于 2^24，可精确表示
+        LocalTensor<float> wGather = wGatherBuf.Get<float>();
+        if (resident) {
+            LocalTensor<int32_t> wOffset = wOffsetBuf.Get<int32_t>();
+            Muls(wGather, targetFloat, static_cast<float>(sizeof(float)), count);
+            Cast(wOffset, wGather, RoundMode::CAST_RINT, count);
+            Gather(wGather, weightLocal, wOffset.ReinterpretCast<uint32_t>(), 0, count);
+        }
+        Mul(wGather, wGather, validLocal, count);
+    }
+
+private:
+    TQue<QuePosition::VECIN, 1> weightQueue;
+    TBuf<QuePosition::VECCALC> maskBuf;
+    TBuf<QuePosition::VECCALC> wOffsetBuf;
+    TBuf<QuePosition::VECCALC> wGatherBuf;
+    LocalTensor<float> weightLocal;
+    GlobalTensor<float> weightGlobal;
+
+    uint32_t cLength;
+    int32_t ignoreIndex;
+    uint32_t tileAlign;
+    bool resident;
+};
+
+// NLLLoss 类算子共用部分：有效掩码、weight gather、加权累加以及 mean/sum/none 的输出与跨核合并。
+// 调用方每个 tile 先 Prepare 得到安全的 target，再把逐样本的 -log(p) 交给 Accumulate。
+// 确定性模式下不按核累加，而是每 8 个样本一个部分和写入 workspace，由 0 核按固定的树形顺序合并
+class LossReducer {
+public:
+    __aicore__ inline LossReducer() {}
+
+    template <typename TilingData>
+    __aicore__ inline void Init(TPipe *pipeIn, GM_ADDR weight, GM_ADDR y, GM_ADDR workspace,
+                                const TilingData &tilingData, uint32_t start, uint32_t length,
+                                bool weightResident = true)
+    {
+        pipe = pipeIn;
+        reduction = tilingData.reduction;
+        tileLength = tilingData.tile_length;
+        tileAlign = CeilDiv(tileLength, CMP_ALIGN) * CMP_ALIGN;
+        usedCoreNum = tilingData.used_core_num;
+        blockIdx = GetBlockIdx();
+        deterministic = tilingData.deterministic != 0 && reduction != REDUCTION_NONE;
+        chunkBase = start / DET_CHUNK;
+        chunkNum = CeilDiv(tilingData.n, DET_CHUNK);
+        chunkAlign = CeilDiv(chunkNum, BLOCK_FLOAT) * BLOCK_FLOAT;
+
+        weights.Init(pipe, weight, tilingData.c, tilingData.ignore_index, tileAlign, weightResident);
+        // none 时 y 为逐样本 loss，各核写回自己的分片
+        if (reduction == REDUCTION_NONE) {
+            yGlobal.SetGlobalBuffer((__gm__ float *)y + start, length);
+        } else {
+            yGlobal.SetGlobalBuffer((__gm__ float *)y, 1);
+        }
+
+        if (reduction == REDUCTION_NONE) {
+            pipe->InitBuffer(yQueue, BUFFER_NUM, tileAlign * sizeof(float));
+        } else if (deterministic) {
+            // workspace 前半为各段 loss 部分和，后半为 weight 部分和
+            slotGlobal.SetGlobalBuffer((__gm__ float *)workspace, 2 * chunkAlign);
+            pipe->InitBuffer(partQueue, BUFFER_NUM, 2 * tileAlign / DET_CHUNK * sizeof(float));
+            pipe->InitBuffer(treeBuf, 2 * DET_TREE_LENGTH * sizeof(float));
+            pipe->InitBuffer(slotBuf, ONE_BLK_SIZE);
+        } else {
+            slotGlobal.SetGlobalBuffer((__gm__ float *)workspace, usedCoreNum * SLOT_NUM);
+            pipe->InitBuffer(accBuf, 2 * tileAlign * sizeof(float));
+            pipe->InitBuffer(workBuf, tileAlign * sizeof(float));
+            pipe->InitBuffer(slotBuf, CeilDiv(usedCoreNum * SLOT_NUM * sizeof(float), ONE_BLK_SIZE) * ONE_BLK_SIZE);
+        }
+    }
+
+    __aicore__ inline uint32_t TileAlign() const
+    {
+        return tileAlign;
+    }
+
+    __aicore__ inline GlobalTensor<float> WeightGlobal() const
+    {
+        return weights.Global();
+    }
+
+    __aicore__ inline LocalTensor<float> GatheredWeight()
+    {
+        return weights.Gathered();
+    }
+
+    __aicore__ inline void LoadWeight()
+    {
+        weights.Load();
+        if (reduction != REDUCTION_NONE && !deterministic) {
+            LocalTensor<float> accLocal = accBuf.Get<float>();
+            Duplicate(accLocal, 0.0f, 2 * tileAlign);
+        }
+    }
+
+    __aicore__ inline void Prepare(const LocalTensor<int32_t> &targetLocal, const LocalTensor<float> &targetFloat,
+                                   uint32_t count)
+    {
+        weights.Prepare(targetLocal, targetFloat, count);
+    }
+
+    // loss 为逐样本的 -log(p)，乘以 weight 后累加，none 时直接写回
+    __aicore__ inline void Accumulate(const LocalTensor<float> &loss, uint32_t progress, uint32_t count)
+    {
+        LocalTensor<float> wGather = weights.Gathered();
+        if (reduction == REDUCTION_NONE) {
+            LocalTensor<float> yLocal = yQueue.AllocTensor<float>();
+            Mul(yLocal, loss, wGather, count);
+            yQueue.EnQue(yLocal);
+            yLocal = yQueue.DeQue<float>();
+            DataCopyExtParams copyParams{1, static_cast<uint32_t>(count * sizeof(float)), 0, 0, 0};
+            DataCopyPad(yGlobal[progress * tileLength], yLocal, copyParams);
+            yQueue.FreeTensor(yLocal);
+            return;
+        }
+        Mul(loss, loss, wGather, count);
+        if (deterministic) {
+            WriteChunks(loss, wGather, progress, count);
+            return;
+        }
+        LocalTensor<float> lossAcc = accBuf.Get<float>();
+        LocalTensor<float> weightAcc = lossAcc[tileAlign];
+        Add(lossAcc, lossAcc, loss, count);
+        Add(weightAcc, weightAcc, wGather, count);
+    }
+
+    // SINGLE_CORE：部分和即最终结果，省去 workspace 往返与核间同步
+    template <bool SINGLE_CORE>
+    __aicore__ inline void Finish()
+    {
+        weights.Free();
+        if (reduction == REDUCTION_NONE) {
+            return;
+        }
+        if (deterministic) {
+            PipeBarrier<PIPE_ALL>();
+            if constexpr (!SINGLE_CORE) {
+                SyncAll();
+            }
+            if (blockIdx == 0) {
+                float lossSum = TreeSum(slotGlobal, chunkNum);
+                float weightSum = TreeSum(slotGlobal[chunkAlign], chunkNum);
+                WriteLoss(lossSum, weightSum);
+            }
+            return;
+        }
+        float lossSum;
+        float weightSum;
+        ReduceAcc(lossSum, weightSum);
+        if constexpr (SINGLE_CORE) {
+            WriteLoss(lossSum, weightSum);
+            return;
+        }
+        WritePartial(lossSum, weightSum);
+        SyncAll();
+        if (blockIdx == 0) {
+            Combine();
+        }
+    }
+
+private:
+    // 每 8 个样本求一个部分和，尾部不足 8 个的样本补 0
+    __aicore__ inline void ChunkSum(const LocalTensor<float> &dst, const LocalTensor<float> &src, uint32_t count)
+    {
+        uint32_t full = count / DET_CHUNK;
+        uint32_t rem = count - full * DET_CHUNK;
+        if (rem != 0) {
+            uint64_t mask[2] = {((static_cast<uint64_t>(1) << DET_CHUNK) - 1) & ~((static_cast<uint64_t>(1) << rem) - 1),
+                                0};
+            Duplicate(src[full * DET_CHUNK], 0.0f, mask, 1, 1, BLOCK_FLOAT);
+        }
+        WholeReduceSum(dst, src, DET_CHUNK, CeilDiv(count, DET_CHUNK), 1, 1, 1);
+    }
+
+    __aicore__ inline void WriteChunks(const LocalTensor<float> &loss, const LocalTensor<float> &weight,
+                                       uint32_t progress, uint32_t count)
+    {
+        uint32_t partStride = tileAlign / DET_CHUNK;
+        LocalTensor<float> partLocal = partQueue.AllocTensor<float>();
+        ChunkSum(partLocal, loss, count);
+        ChunkSum(partLocal[partStride], weight, count);
+        partQueue.EnQue(partLocal);
+        partLocal = partQueue.DeQue<float>();
+        uint32_t offset = chunkBase + progress * tileLength / DET_CHUNK;
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(CeilDiv(count, DET_CHUNK) * sizeof(float)), 0, 0, 0};
+        DataCopyPad(slotGlobal[offset], partLocal, copyParams);
+        DataCopyPad(slotGlobal[chunkAlign + offset], partLocal[partStride], copyParams);
+        partQueue.FreeTensor(partLocal);
+    }
+
+    // 长度为 2 的幂的向量两两折半相加到 64 个，再整组规约为一个值，顺序固定
+    __aicore__ inline void TreeReduce(const LocalTensor<float> &local)
+    {
+        for (uint32_t half = DET_TREE_LENGTH / 2; half >= CMP_ALIGN; half /= 2) {
+            Add(local, local, local[half], half);
+        }
+        WholeReduceSum(local, local, CMP_ALIGN, 1, 1, 1, BLOCK_FLOAT);
+    }
+
+    // 部分和按 DET_TREE_LENGTH 分块，不足部分补 0，各块结果再做一次同样的规约
+    __aicore__ inline float TreeSum(const GlobalTensor<float> &partial, uint32_t length)
+    {
+        LocalTensor<float> treeLocal = treeBuf.Get<float>();
+        LocalTensor<float> blockSums = treeLocal[DET_TREE_LENGTH];
+        Duplicate(blockSums, 0.0f, DET_TREE_LENGTH);
+        uint32_t blockNum = CeilDiv(length, DET_TREE_LENGTH);
+        for (uint32_t b = 0; b < blockNum; b++) {
+            uint32_t size = b == blockNum - 1 ? length - b * DET_TREE_LENGTH : DET_TREE_LENGTH;
+            uint8_t rightPad = CeilDiv(size, BLOCK_FLOAT) * BLOCK_FLOAT - size;
+            Duplicate(treeLocal, 0.0f, DET_TREE_LENGTH);
+            WaitPipe<HardEvent::V_MTE2>(pipe);
+            DataCopyExtParams copyParams{1, static_cast<uint32_t>(size * sizeof(float)), 0, 0, 0};
+            DataCopyPadExtParams<float> padParams{true, 0, rightPad, 0.0f};
+            DataCopyPad(treeLocal, partial[b * DET_TREE_LENGTH], copyParams, padParams);
+            WaitPipe<HardEvent::MTE2_V>(pipe);
+            TreeReduce(treeLocal);
+            WaitPipe<HardEvent::V_S>(pipe);
+            blockSums.SetValue(b, treeLocal.GetValue(0));
+            WaitPipe<HardEvent::S_V>(pipe);
+        }
+        TreeReduce(blockSums);
+        WaitPipe<HardEvent::V_S>(pipe);
+        return blockSums.GetValue(0);
+    }
+
+    __aicore__ inline void ReduceAcc(float &lossSum, float &weightSum)
+    {
+        LocalTensor<float> lossAcc = accBuf.Get<float>();
+        LocalTensor<float> weightAcc = lossAcc[tileAlign];
+        LocalTensor<float> workLocal = workBuf.Get<float>();
+        ReduceSum(lossAcc, lossAcc, workLocal, tileAlign);
+        ReduceSum(weightAcc, weightAcc, workLocal, tileAlign);
+        WaitPipe<HardEvent::V_S>(pipe);
+        lossSum = lossAcc.GetValue(0);
+        weightSum = weightAcc.GetValue(0);
+    }
+
+    __aicore__ inline void WritePartial(float lossSum, float weightSum)
+    {
+        LocalTensor<float> slotLocal = slotBuf.Get<float>();
+        slotLocal.SetValue(0, lossSum);
+        slotLocal.SetValue(1, weightSum);
+        WaitPipe<HardEvent::S_MTE3>(pipe);
+        DataCopy(slotGlobal[blockIdx * SLOT_NUM], slotLocal, SLOT_NUM);
+        PipeBarrier<PIPE_ALL>();
+    }
+
+    // 0 核按核号顺序累加各槽位
+    __aicore__ inline void Combine()
+    {
+        LocalTensor<float> slotLocal = slotBuf.Get<float>();
+        DataCopy(slotLocal, slotGlobal, usedCoreNum * SLOT_NUM);
+        WaitPipe<HardEvent::MTE2_S>(pipe);
+        float lossSum = 0.0f;
+        float weightSum = 0.0f;
+        for (uint32_t i = 0; i < usedCoreNum; i++) {
+            lossSum += slotLocal.GetValue(i * SLOT_NUM);
+            weightSum += slotLocal.GetValue(i * SLOT_NUM + 1);
+        }
+        WriteLoss(lossSum, weightSum);
+    }
+
+    // mean 时除以有效权重之和
+    __aicore__ inline void WriteLoss(float lossSum, float weightSum)
+    {
+        LocalTensor<float> slotLocal = slotBuf.Get<float>();
+        slotLocal.SetValue(0, reduction == REDUCTION_MEAN ? lossSum / weightSum : lossSum);
+        WaitPipe<HardEvent::S_MTE3>(pipe);
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(sizeof(float)), 0, 0, 0};
+        DataCopyPad(yGlobal, slotLocal, copyParams);
+    }
+
+private:
+    TPipe *pipe;
+    WeightGather weights;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> yQueue;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> partQueue;
+    TBuf<QuePosition::VECCALC> accBuf;
+    TBuf<QuePosition::VECCALC> treeBuf;
+    TBuf<QuePosition::VECCALC> workBuf;
+    TBuf<QuePosition::VECCALC> slotBuf;
+
+    GlobalTensor<float> yGlobal;
+    GlobalTensor<float> slotGlobal;
+
+    uint32_t reduction;
+    uint32_t tileLength;
+    uint32_t tileAlign;
+    uint32_t usedCoreNum;
+    uint32_t blockIdx;
+    bool deterministic;
+    uint32_t chunkBase;
+    uint32_t chunkNum;
+    uint32_t chunkAlign;
+};
+
+#endif // NLL_LOSS_COMMON_H
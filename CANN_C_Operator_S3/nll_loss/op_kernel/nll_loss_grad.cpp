@@ -0,0 +1,246 @@
+#include "nll_loss_common.h"
+
+// 清零时每次从 UB 搬出的元素数
+constexpr uint32_t ZERO_LENGTH = 8192;
+
+// x_grad 每行只有 target 处一个非零值 -w[t] * grad_y (mean 时再除以有效 weight 之和)：
+// 先用整块 DMA 把本核负责的行清零，再逐样本把非零值写到 x_grad[i, target[i]]
+class KernelNLLLossGrad {
+public:
+    __aicore__ inline KernelNLLLossGrad() {}
+
+    // 初始化
+    __aicore__ inline void Init(GM_ADDR gradY, GM_ADDR target, GM_ADDR weight, GM_ADDR xGrad,
+                                GM_ADDR workspace, const NLLLossGradTilingData &tilingData, TPipe *pipeIn)
+    {
+        pipe = pipeIn;
+        c = tilingData.c;
+        reduction = tilingData.reduction;
+        ignoreIndex = tilingData.ignore_index;
+        tileLength = tilingData.tile_length;
+        tileAlign = CeilDiv(tileLength, CMP_ALIGN) * CMP_ALIGN;
+        usedCoreNum = tilingData.used_core_num;
+        weightResident = tilingData.weight_resident != 0;
+        uint32_t start = GetBlockIdx() * tilingData.block_length;
+        length = tilingData.n - start < tilingData.block_length ? tilingData.n - start : tilingData.block_length;
+        weights.Init(pipe, weight, c, ignoreIndex, tileAlign, weightResident);
+
+        // none 时 grad_y 为逐样本梯度，否则为标量
+        if (reduction == REDUCTION_NONE) {
+            gradYGlobal.SetGlobalBuffer((__gm__ float *)gradY + start, length);
+        } else {
+            gradYGlobal.SetGlobalBuffer((__gm__ float *)gradY, 1);
+        }
+        targetGlobal.SetGlobalBuffer((__gm__ int32_t *)target + start, length);
+        xGradGlobal.SetGlobalBuffer((__gm__ float *)xGrad + static_cast<uint64_t>(start) * c,
+                                    static_cast<uint64_t>(length) * c);
+        slotGlobal.SetGlobalBuffer((__gm__ float *)workspace, usedCoreNum * SLOT_NUM);
+
+        pipe->InitBuffer(zeroBuf, ZERO_LENGTH * sizeof(float));
+        pipe->InitBuffer(targetQueue, BUFFER_NUM, tileAlign * sizeof(int32_t));
+        pipe->InitBuffer(gradQueue, BUFFER_NUM, tileAlign * sizeof(float));
+        // 每个散写值占一个 32B 块，作为单元素 DMA 的源地址
+        pipe->InitBuffer(valueQueue, BUFFER_NUM, tileAlign * ONE_BLK_SIZE);
+        if (!weightResident) {
+            pipe->InitBuffer(weightSlotQueue, 1, tileAlign * ONE_BLK_SIZE);
+            pipe->InitBuffer(slotOffsetBuf, tileAlign * sizeof(int32_t));
+        }
+        // 安全 target、散写值、weight 累加和
+        pipe->InitBuffer(calcBuf, 3 * tileAlign * sizeof(float));
+        pipe->InitBuffer(scalarBuf, CeilDiv(usedCoreNum * SLOT_NUM * sizeof(float), ONE_BLK_SIZE) * ONE_BLK_SIZE);
+    }
+
+    __aicore__ inline void Process()
+    {
+        weights.Load();
+        if (!weightResident) {
+            LocalTensor<int32_t> slotOffset = slotOffsetBuf.Get<int32_t>();
+            ArithProgression<int32_t>(slotOffset, 0, static_cast<int32_t>(ONE_BLK_SIZE), tileAlign);
+        }
+        ZeroFill();
+
+        float scale = -1.0f;
+        if (reduction != REDUCTION_NONE) {
+            scale = -ReadScalar(gradYGlobal);
+            if (reduction == REDUCTION_MEAN) {
+                scale /= TotalWeight();
+            }
+        }
+        // 清零的搬出先于散写完成，避免同一地址的写入乱序
+        PipeBarrier<PIPE_MTE3>();
+
+        uint32_t tileNum = CeilDiv(length, tileLength);
+        for (uint32_t i = 0; i < tileNum; i++) {
+            uint32_t count = i == tileNum - 1 ? length - i * tileLength : tileLength;
+            Scatter(i, count, scale);
+        }
+        weights.Free();
+    }
+
+private:
+    __aicore__ inline void ZeroFill()
+    {
+        LocalTensor<float> zeroLocal = zeroBuf.Get<float>();
+        Duplicate(zeroLocal, 0.0f, ZERO_LENGTH);
+        WaitPipe<HardEvent::V_MTE3>(pipe);
+        uint64_t total = static_cast<uint64_t>(length) * c;
+        for (uint64_t offset = 0; offset < total; offset += ZERO_LENGTH) {
+            uint32_t size = total - offset < ZERO_LENGTH ? total - offset : ZERO_LENGTH;
+            DataCopyExtParams copyParams{1, static_cast<uint32_t>(size * sizeof(float)), 0, 0, 0};
+            DataCopyPad(xGradGlobal[offset], zeroLocal, copyParams);
+        }
+    }
+
+    __aicore__ inline float ReadScalar(const GlobalTensor<float> &global)
+    {
+        LocalTensor<float> scalarLocal = scalarBuf.Get<float>();
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(sizeof(float)), 0, 0, 0};
+        DataCopyPadExtParams<float> padParams{false, 0, 0, 0};
+        DataCopyPad(scalarLocal, global, copyParams, padParams);
+        WaitPipe<HardEvent::MTE2_S>(pipe);
+        return scalarLocal.GetValue(0);
+    }
+
+    __aicore__ inline bool IsValid(int32_t t) const
+    {
+        return t != ignoreIndex && t >= 0 && t < static_cast<int32_t>(c);
+    }
+
+    // 搬入 target，既供标量读取下标，也供向量生成掩码与 gather weight
+    __aicore__ inline LocalTensor<int32_t> LoadTarget(uint32_t progress, uint32_t count)
+    {
+        LocalTensor<int32_t> targetLocal = targetQueue.AllocTensor<int32_t>();
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(count * sizeof(int32_t)), 0, 0, 0};
+        DataCopyPadExtParams<int32_t> padParams{false, 0, 0, 0};
+        DataCopyPad(targetLocal, targetGlobal[progress * tileLength], copyParams, padParams);
+        targetQueue.EnQue(targetLocal);
+        targetLocal = targetQueue.DeQue<int32_t>();
+        WaitPipe<HardEvent::MTE2_S>(pipe);
+        return targetLocal;
+    }
+
+    // weight 不常驻时按 target 从 GM 逐个取出，每个占一个 32B 块后 gather 成连续向量；结果为 w[t] * valid
+    __aicore__ inline void GatherWeight(const LocalTensor<int32_t> &targetLocal, uint32_t count)
+    {
+        if (!weightResident) {
+            LocalTensor<float> slotLocal = weightSlotQueue.AllocTensor<float>();
+            GlobalTensor<float> weightGlobal = weights.Global();
+            DataCopyExtParams copyParams{1, static_cast<uint32_t>(sizeof(float)), 0, 0, 0};
+            DataCopyPadExtParams<float> padParams{false, 0, 0, 0};
+            for (uint32_t r = 0; r < count; r++) {
+                int32_t t = targetLocal.GetValue(r);
+                DataCopyPad(slotLocal[r * BLOCK_FLOAT], weightGlobal[IsValid(t) ? t : 0], copyParams, padParams);
+            }
+            weightSlotQueue.EnQue(slotLocal);
+            slotLocal = weightSlotQueue.DeQue<float>();
+            Gather(weights.Gathered(), slotLocal, slotOffsetBuf.Get<uint32_t>(), 0, count);
+            weightSlotQueue.FreeTensor(slotLocal);
+        }
+        weights.Prepare(targetLocal, calcBuf.Get<float>(), count);
+    }
+
+    // 前向不输出 total_weight，mean 时各核求本核的有效 weight 之和，经 workspace 交换后每核按核号顺序累加
+    __aicore__ inline float TotalWeight()
+    {
+        LocalTensor<float> weightAcc = calcBuf.Get<float>()[2 * tileAlign];
+        Duplicate(weightAcc, 0.0f, tileAlign);
+        uint32_t tileNum = CeilDiv(length, tileLength);
+        for (uint32_t i = 0; i < tileNum; i++) {
+            uint32_t count = i == tileNum - 1 ? length - i * tileLength : tileLength;
+            LocalTensor<int32_t> targetLocal = LoadTarget(i, count);
+            GatherWeight(targetLocal, count);
+            Add(weightAcc, weightAcc, weights.Gathered(), count);
+            targetQueue.FreeTensor(targetLocal);
+        }
+        LocalTensor<float> workLocal = calcBuf.Get<float>()[tileAlign];
+        ReduceSum(weightAcc, weightAcc, workLocal, tileAlign);
+        WaitPipe<HardEvent::V_S>(pipe);
+        float partial = weightAcc.GetValue(0);
+
+        LocalTensor<float> slotLocal = scalarBuf.Get<float>();
+        slotLocal.SetValue(0, partial);
+        WaitPipe<HardEvent::S_MTE3>(pipe);
+        DataCopy(slotGlobal[GetBlockIdx() * SLOT_NUM], slotLocal, SLOT_NUM);
+        PipeBarrier<PIPE_ALL>();
+        SyncAll();
+        DataCopy(slotLocal, slotGlobal, usedCoreNum * SLOT_NUM);
+        WaitPipe<HardEvent::MTE2_S>(pipe);
+        float total = 0.0f;
+        for (uint32_t i = 0; i < usedCoreNum; i++) {
+            total += slotLocal.GetValue(i * SLOT_NUM);
+        }
+        return total;
+    }
+
+    __aicore__ inline void Scatter(uint32_t progress, uint32_t count, float scale)
+    {
+        LocalTensor<int32_t> targetLocal = LoadTarget(progress, count);
+        GatherWeight(targetLocal, count);
+        LocalTensor<float> value = calcBuf.Get<float>()[tileAlign];
+        if (reduction == REDUCTION_NONE) {
+            LocalTensor<float> gradLocal = gradQueue.AllocTensor<float>();
+            DataCopyExtParams copyParams{1, static_cast<uint32_t>(count * sizeof(float)), 0, 0, 0};
+            DataCopyPadExtParams<float> padParams{false, 0, 0, 0};
+            DataCopyPad(gradLocal, gradYGlobal[progress * tileLength], copyParams, padParams);
+            gradQueue.EnQue(gradLocal);
+            gradLocal = gradQueue.DeQue<float>();
+            Mul(value, weights.Gathered(), gradLocal, count);
+            Muls(value, value, scale, count);
+            gradQueue.FreeTensor(gradLocal);
+        } else {
+            Muls(value, weights.Gathered(), scale, count);
+        }
+
+        // 每个值广播成一个 32B 块，再逐个写到 x_grad[i, target[i]]，ignore 的样本保持为 0
+        LocalTensor<float> valueLocal = valueQueue.AllocTensor<float>();
+        Brcb(valueLocal, value, static_cast<uint8_t>(tileAlign / BLOCK_FLOAT), {1, BLOCK_FLOAT});
+        valueQueue.EnQue(valueLocal);
+        valueLocal = valueQueue.DeQue<float>();
+        DataCopyExtParams copyParams{1, static_cast<uint32_t>(sizeof(float)), 0, 0, 0};
+        uint64_t rowOffset = static_cast<uint64_t>(progress) * tileLength * c;
+        for (uint32_t r = 0; r < count; r++) {
+            int32_t t = targetLocal.GetValue(r);
+            if (IsValid(t)) {
+                DataCopyPad(xGradGlobal[rowOffset + t], valueLocal[r * BLOCK_FLOAT], copyParams);
+            }
+            rowOffset += c;
+        }
+        valueQueue.FreeTensor(valueLocal);
+        targetQueue.FreeTensor(targetLocal);
+    }
+
+private:
+    TPipe *pipe;
+    WeightGather weights;
+    TQue<QuePosition::VECIN, BUFFER_NUM> targetQueue;
+    TQue<QuePosition::VECIN, BUFFER_NUM> gradQueue;
+    TQue<QuePosition::VECIN, 1> weightSlotQueue;
+    TQue<QuePosition::VECOUT, BUFFER_NUM> valueQueue;
+    TBuf<QuePosition::VECCALC> zeroBuf;
+    TBuf<QuePosition::VECCALC> slotOffsetBuf;
+    TBuf<QuePosition::VECCALC> calcBuf;
+    TBuf<QuePosition::VECCALC> scalarBuf;
+
+    GlobalTensor<float> gradYGlobal;
+    GlobalTensor<int32_t> targetGlobal;
+    GlobalTensor<float> xGradGlobal;
+    GlobalTensor<float> slotGlobal;
+
+    uint32_t c;
+    uint32_t reduction;
+    int32_t ignoreIndex;
+    uint32_t tileLength;
+    uint32_t tileAlign;
+    uint32_t usedCoreNum;
+    uint32_t length;
+    bool weightResident;
+};
+
+extern "C" __global__ __aicore__ void nll_loss_grad(GM_ADDR grad_y, GM_ADDR x, GM_ADDR target, GM_ADDR weight, GM_ADDR x_grad, GM_ADDR workspace, GM_ADDR tiling) {
+    GET_TILING_DATA(tiling_data, tiling);
+    GM_ADDR usrWorkspace = GetUserWorkspace(workspace);
+    TPipe pipe;
+    KernelNLLLossGrad op;
+    op.Init(grad_y, target, weight, x_grad, usrWorkspace, tiling_data, &pipe);
+    op.Process();
+}
@@ -0,0 +1,30 @@
+import numpy as np
+import os
+np.random.seed(143)
+
+
+# 沿 dimension 取最值的位置与最值，select_last_index 时相等的取最后一个
+def arg_reduce(x, dimension, largest, select_last_index):
+    moved = np.moveaxis(x, dimension, -1)
+    source = moved[..., ::-1] if select_last_index else moved
+    position = source.argmax(axis=-1) if largest else source.argmin(axis=-1)
+    indice = moved.shape[-1] - 1 - position if select_last_index else position
+    values = np.take_along_axis(moved, indice[..., None], axis=-1)[..., 0]
+    return indice, values
+
+
+def gen_golden_data_simple():
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    # int64 的 indices 走 SPLIT：lane 内记段号，合并时按段号与段宽换算为位置；最大值在两段中各出现一次，应取前一个
+    input_x = np.random.uniform(-10, 10, [3, 100000]).astype(np.float32)
+    input_x[1, 23456] = 20.0
+    input_x[1, 87654] = 20.0
+    input_x.tofile("./input/input_x.bin")
+    indice, values = arg_reduce(input_x, 1, True, False)
+    indice.astype(np.int64).tofile("./output/golden_indice.bin")
+    values.tofile("./output/golden_values.bin")
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
@@ -0,0 +1,39 @@
+import numpy as np
+import os
+np.random.seed(143)
+
+
+# bf16 按 uint16 存放：float32 的高 16 位，舍入到最近偶数
+def to_bf16(x):
+    bits = x.astype(np.float32).view(np.uint32)
+    bits = bits + 0x7FFF + ((bits >> 16) & 1)
+    return (bits >> 16).astype(np.uint16)
+
+
+def from_bf16(x):
+    return (x.astype(np.uint32) << 16).view(np.float32)
+
+
+# 沿 dimension 取最值的位置与最值，select_last_index 时相等的取最后一个
+def arg_reduce(x, dimension, largest, select_last_index):
+    moved = np.moveaxis(x, dimension, -1)
+    source = moved[..., ::-1] if select_last_index else moved
+    position = source.argmax(axis=-1) if largest else source.argmin(axis=-1)
+    indice = moved.shape[-1] - 1 - position if select_last_index else position
+    values = np.take_along_axis(moved, indice[..., None], axis=-1)[..., 0]
+    return indice, values
+
+
+def gen_golden_data_simple():
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    # bf16 在核内放宽为 float 比较，values 按 CAST_RINT 写回 bf16；输入本身可由 bf16 表示，写回应无误差
+    input_x = to_bf16(np.random.uniform(-100, 100, [16, 3000])).reshape([16, 3000])
+    input_x.tofile("./input/input_x.bin")
+    indice, values = arg_reduce(from_bf16(input_x).reshape([16, 3000]), 1, True, False)
+    indice.astype(np.int32).tofile("./output/golden_indice.bin")
+    to_bf16(values).tofile("./output/golden_values.bin")
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
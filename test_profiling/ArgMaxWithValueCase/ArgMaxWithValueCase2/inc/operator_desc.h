@@ -52,6 +52,13 @@ struct OperatorDesc {
     int64_t dimension;
 
     bool keep_dims;
+    bool select_last_index = false;
+    // x 为转置、切片等视图时各维的 stride(以元素计)，为空即连续
+    std::vector<int64_t> x_strides;
+    // 非空时沿其中各维同时归约，indices 为在归约维上展平的位置
+    std::vector<int64_t> axes;
+    // indices 的数据类型，须与 indices 输出的 desc 一致
+    int64_t output_type = ACL_INT32;
     std::string opType;
     std::vector<aclTensorDesc *> inputDesc;
     std::vector<aclTensorDesc *> outputDesc;
@@ -340,9 +340,13 @@ bool OpRunner::RunOp()
     size_t workspaceSize = 0;
 	aclOpExecutor *handle = nullptr;
 
-    auto ret = aclnnArgMaxWithValueGetWorkspaceSize(inputTensor_[0],  opDesc_->dimension,opDesc_->keep_dims,
-                                                      outputTensor_[0], outputTensor_[1],&workspaceSize, &handle);
+    aclIntArray *xStrides = aclCreateIntArray(opDesc_->x_strides.data(), opDesc_->x_strides.size());
+    aclIntArray *axes = aclCreateIntArray(opDesc_->axes.data(), opDesc_->axes.size());
+    auto ret = aclnnArgMaxWithValueGetWorkspaceSize(inputTensor_[0],  opDesc_->dimension, opDesc_->keep_dims, opDesc_->select_last_index,
+                                                      xStrides, axes, opDesc_->output_type, outputTensor_[0], outputTensor_[1],&workspaceSize, &handle);
     if (ret != ACL_SUCCESS) {
+        (void)aclDestroyIntArray(xStrides);
+        (void)aclDestroyIntArray(axes);
         (void)aclrtDestroyStream(stream);
         ERROR_LOG("Get Operator Workspace failed. error code is %d", static_cast<int32_t>(ret));
         return false;
@@ -356,6 +360,8 @@ bool OpRunner::RunOp()
         }
     }
     ret = aclnnArgMaxWithValue(workspace, workspaceSize, handle, stream);
+    (void)aclDestroyIntArray(xStrides);
+    (void)aclDestroyIntArray(axes);
 
     if (ret != ACL_SUCCESS) {
         (void)aclrtDestroyStream(stream);
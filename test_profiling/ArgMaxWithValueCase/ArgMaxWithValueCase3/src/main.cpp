@@ -32,6 +32,7 @@ OperatorDesc CreateOpDesc()
     OperatorDesc opDesc;
     opDesc.dimension = 2;
     opDesc.keep_dims = true;
+    opDesc.output_type = outputIndiceType;
     opDesc.AddInputTensorDesc(inputType, inputshape.size(), inputshape.data(), format);
     opDesc.AddOutputTensorDesc(outputIndiceType, outputshape.size(), outputshape.data(), format);
     opDesc.AddOutputTensorDesc(outputValuesType, outputshape.size(), outputshape.data(), format);
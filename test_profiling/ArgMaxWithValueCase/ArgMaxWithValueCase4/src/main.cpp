@@ -32,6 +32,7 @@ OperatorDesc CreateOpDesc()
     OperatorDesc opDesc;
     opDesc.dimension = 0;
     opDesc.keep_dims = false;
+    opDesc.output_type = outputIndiceType;
     opDesc.AddInputTensorDesc(inputType, inputshape.size(), inputshape.data(), format);
     opDesc.AddOutputTensorDesc(outputIndiceType, outputshape.size(), outputshape.data(), format);
     opDesc.AddOutputTensorDesc(outputValuesType, outputshape.size(), outputshape.data(), format);
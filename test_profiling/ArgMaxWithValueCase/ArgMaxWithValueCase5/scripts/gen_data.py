@@ -0,0 +1,51 @@
+import numpy as np
+import os
+import tensorflow as tf
+np.random.seed(143)
+def fuzz_branch():
+    x_shape,indice_shape,values_shape,dimension,keep_dims,x_strides = gen_golden_data_simple()
+    res_json = {
+        "input_desc": {"x": {"shape": [*x_shape]}},
+        "output_desc": {"indice": {"shape": [*indice_shape]},
+                        "values": {"shape": [*values_shape]}
+        },
+        "attr": {"dimension": {"value": dimension},
+                  "keep_dims": {"value": keep_dims},
+                  "x_strides": {"value": x_strides}
+        }
+    }
+    print("res_json = ",res_json)
+    return res_json
+
+def calc_expect_func(x, indice, values, dimension, keep_dims):
+    
+    
+    res1 = np.fromfile("./output/golden_indice.bin", dtype=indice["dtype"])
+    res2 = np.fromfile("./output/golden_values.bin", dtype=values["dtype"])
+
+    return [res1, res2]
+
+
+def gen_golden_data_simple():
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    # x 为 [384, 520] 的连续张量转置后的视图 [520, 384]，stride 为 [1, 520]，沿原来不连续的一维归约
+    base = np.random.uniform(-10, 10, [384, 520]).astype(np.float16)
+    input_x = base.T
+    x_strides = [1, 520]
+    dimension = 1
+    keep_dims = False
+    # 写入的是底层存储，真值按物化后的连续张量计算
+    base.tofile("./input/input_x.bin")
+    materialized = np.ascontiguousarray(input_x)
+    indice = tf.argmax(materialized, axis=dimension, output_type=tf.int32)
+    values = tf.reduce_max(materialized, axis=dimension,keepdims=keep_dims)
+    golden_indice = indice.numpy()
+    golden_values = values.numpy()
+    golden_indice.tofile("./output/golden_indice.bin")
+    golden_values.tofile("./output/golden_values.bin")
+    return input_x.shape, indice.shape ,values.shape,dimension, keep_dims, x_strides
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
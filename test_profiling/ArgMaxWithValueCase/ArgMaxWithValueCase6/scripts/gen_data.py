@@ -0,0 +1,55 @@
+import numpy as np
+import os
+np.random.seed(143)
+def fuzz_branch():
+    x_shape,indice_shape,values_shape,axes,keep_dims,select_last_index = gen_golden_data_simple()
+    res_json = {
+        "input_desc": {"x": {"shape": [*x_shape]}},
+        "output_desc": {"indice": {"shape": [*indice_shape]},
+                        "values": {"shape": [*values_shape]}
+        },
+        "attr": {"axes": {"value": axes},
+                  "keep_dims": {"value": keep_dims},
+                  "select_last_index": {"value": select_last_index}
+        }
+    }
+    print("res_json = ",res_json)
+    return res_json
+
+def calc_expect_func(x, indice, values, axes, keep_dims, select_last_index):
+    
+    
+    res1 = np.fromfile("./output/golden_indice.bin", dtype=indice["dtype"])
+    res2 = np.fromfile("./output/golden_values.bin", dtype=values["dtype"])
+
+    return [res1, res2]
+
+
+# 沿 axes 同时归约，indices 为在归约维上按行优先展平的位置，并列时取最后一个
+def arg_reduce_last(x, axes, largest):
+    kept = [d for d in range(x.ndim) if d not in axes]
+    flat = np.transpose(x, kept + axes).reshape([x.shape[d] for d in kept] + [-1])
+    reverse = flat[..., ::-1]
+    position = reverse.argmax(axis=-1) if largest else reverse.argmin(axis=-1)
+    indice = (flat.shape[-1] - 1 - position).astype(np.int32)
+    values = flat.max(axis=-1) if largest else flat.min(axis=-1)
+    return indice, values
+
+
+def gen_golden_data_simple():
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    # 取值只有少数几个整数，每组归约元素中最值出现多次
+    input_x = np.random.randint(-4, 5, [8, 17, 64, 48]).astype(np.float16)
+    axes = [2, 3]
+    keep_dims = False
+    select_last_index = True
+    input_x.tofile("./input/input_x.bin")
+    indice, values = arg_reduce_last(input_x, axes, True)
+    indice.tofile("./output/golden_indice.bin")
+    values.tofile("./output/golden_values.bin")
+    return input_x.shape, indice.shape ,values.shape,axes, keep_dims, select_last_index
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
@@ -0,0 +1,51 @@
+import numpy as np
+import os
+import tensorflow as tf
+np.random.seed(143)
+def fuzz_branch():
+    x_shape,indice_shape,values_shape,dimension,keep_dims = gen_golden_data_simple()
+    res_json = {
+        "input_desc": {"x": {"shape": [*x_shape]}},
+        "output_desc": {"indice": {"shape": [*indice_shape]},
+                        "values": {"shape": [*values_shape]}
+        },
+        "attr": {"dimension": {"value": dimension},
+                  "keep_dims": {"value": keep_dims}
+        }
+    }
+    print("res_json = ",res_json)
+    return res_json
+
+def calc_expect_func(x, indice, values, dimension, keep_dims):
+    
+    
+    res1 = np.fromfile("./output/golden_indice.bin", dtype=indice["dtype"])
+    res2 = np.fromfile("./output/golden_values.bin", dtype=values["dtype"])
+
+    return [res1, res2]
+
+
+def gen_golden_data_simple():
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    input_x = np.random.uniform(-10, 10, [200, 1000]).astype(np.float16)
+    dimension = 1
+    keep_dims = False
+    # 按 FRACTAL_NZ 排布：storage[n1, m1, m0, n0] = x[m1 * 16 + m0, n1 * 16 + n0]；
+    # 补齐的部分填很大的值，读到补齐部分时结果出错
+    m1, n1 = (200 + 15) // 16, (1000 + 15) // 16
+    padded = np.full([m1 * 16, n1 * 16], 60000, dtype=np.float16)
+    padded[:200, :1000] = input_x
+    storage = padded.reshape([m1, 16, n1, 16]).transpose(2, 0, 1, 3)
+    np.ascontiguousarray(storage).tofile("./input/input_x.bin")
+    indice = tf.argmax(input_x, axis=dimension, output_type=tf.int32)
+    values = tf.reduce_max(input_x, axis=dimension,keepdims=keep_dims)
+    golden_indice = indice.numpy()
+    golden_values = values.numpy()
+    golden_indice.tofile("./output/golden_indice.bin")
+    golden_values.tofile("./output/golden_values.bin")
+    return input_x.shape, indice.shape ,values.shape,dimension, keep_dims
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
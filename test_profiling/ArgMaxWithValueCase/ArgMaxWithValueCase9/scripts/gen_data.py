@@ -0,0 +1,28 @@
+import numpy as np
+import os
+np.random.seed(143)
+
+
+# 沿 dimension 取最值的位置与最值，select_last_index 时相等的取最后一个
+def arg_reduce(x, dimension, largest, select_last_index):
+    moved = np.moveaxis(x, dimension, -1)
+    source = moved[..., ::-1] if select_last_index else moved
+    position = source.argmax(axis=-1) if largest else source.argmin(axis=-1)
+    indice = moved.shape[-1] - 1 - position if select_last_index else position
+    values = np.take_along_axis(moved, indice[..., None], axis=-1)[..., 0]
+    return indice, values
+
+
+def gen_golden_data_simple():
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    # 行少而归约轴长，走 SPLIT：每行切成多段并行归约后合并；取值少，最大值在段内与段间都多次出现
+    input_x = np.random.randint(-50, 50, [4, 65536]).astype(np.float16)
+    input_x.tofile("./input/input_x.bin")
+    indice, values = arg_reduce(input_x, 1, True, True)
+    indice.astype(np.int32).tofile("./output/golden_indice.bin")
+    values.tofile("./output/golden_values.bin")
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
@@ -0,0 +1,28 @@
+import torch
+import torch.nn as nn
+import numpy as np
+import os    
+def gen_golden_data_simple():    
+    test_type = np.float32
+    target_type = np.int32
+    # 非默认的 ignore_index，部分样本取该值，不计入 loss 与 weight 之和
+    input_x = np.random.uniform(-5, 5,[64,1000] ).astype(test_type)
+    input_target = np.random.uniform(0,1000,[64] ).astype(target_type)
+    input_weight= np.random.uniform(0,1,[1000] ).astype(test_type)
+    reduction="mean";
+    ignore_index=5;
+    input_target[::6] = ignore_index
+    res = torch.nn.functional.cross_entropy(torch.Tensor(input_x), torch.Tensor(input_target).to(torch.long), weight=torch.Tensor(input_weight), size_average=None, 
+                                            ignore_index=ignore_index, reduce=None, reduction=reduction)
+    golden = res.numpy().astype(test_type)
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    input_x.tofile("./input/input_x.bin")
+    input_target.tofile("./input/target.bin")
+    input_weight.tofile("./input/weight.bin")
+    golden.tofile("./output/golden.bin")
+
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
\ No newline at end of file
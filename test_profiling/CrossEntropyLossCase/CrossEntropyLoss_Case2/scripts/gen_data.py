@@ -0,0 +1,28 @@
+import torch
+import torch.nn as nn
+import numpy as np
+import os    
+def gen_golden_data_simple():    
+    test_type = np.float32
+    target_type = np.int32
+    # C 超过单次搬入的 1024 类，按块做在线 log-sum-exp，最后一块不满；
+    # 取值范围较大，各块的最大值不同，检查块间的重新缩放
+    input_x = np.random.uniform(-20, 20,[256,5000] ).astype(test_type)
+    input_target = np.random.uniform(0,5000,[256] ).astype(target_type)
+    input_weight= np.random.uniform(0,1,[5000] ).astype(test_type)
+    reduction="mean";
+    ignore_index=-100;
+    res = torch.nn.functional.cross_entropy(torch.Tensor(input_x), torch.Tensor(input_target).to(torch.long), weight=torch.Tensor(input_weight), size_average=None, 
+                                            ignore_index=ignore_index, reduce=None, reduction=reduction)
+    golden = res.numpy().astype(test_type)
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    input_x.tofile("./input/input_x.bin")
+    input_target.tofile("./input/target.bin")
+    input_weight.tofile("./input/weight.bin")
+    golden.tofile("./output/golden.bin")
+
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
\ No newline at end of file
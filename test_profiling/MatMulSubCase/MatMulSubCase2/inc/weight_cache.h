@@ -0,0 +1,72 @@
+/**
+* @file weight_cache.h
+*
+* Copyright (C) 2023. Huawei Technologies Co., Ltd. All rights reserved.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+*/
+#ifndef WEIGHT_CACHE_H
+#define WEIGHT_CACHE_H
+
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "aclnn/acl_meta.h"
+#include "acl/acl.h"
+
+/**
+ * Packed weight cache
+ * x2 为常量权重时，只在首次调用时把 ND 数据重排为 FRACTAL_NZ 并驻留在 device 上，
+ * 之后以 (device 地址, 版本号) 命中缓存，直接复用 NZ 张量。
+ */
+class PackedWeightCache {
+public:
+    PackedWeightCache() = default;
+
+    /**
+     * @brief Destructor, release all packed weights
+     */
+    ~PackedWeightCache();
+
+    /**
+     * @brief Get packed NZ tensor of a [..., k, n] ND weight
+     * @param [in] devAddr: device address of the ND weight, used as cache key
+     * @param [in] version: weight version, bump it when the weight content changes
+     * @param [in] hostData: host copy of the ND weight, only read on cache miss
+     * @param [in] dataType: ACL_FLOAT16 or ACL_FLOAT
+     * @param [in] shape: ND shape of the weight, leading dims are batch
+     * @return NZ tensor owned by the cache, nullptr on failure
+     */
+    aclTensor *Acquire(const void *devAddr, uint64_t version, const void *hostData, aclDataType dataType,
+                       const std::vector<int64_t> &shape);
+
+    /**
+     * @brief Release all packed weights
+     */
+    void Clear();
+
+    uint64_t Hits() const { return hits_; }
+    uint64_t Misses() const { return misses_; }
+
+private:
+    struct Entry {
+        uint64_t version;
+        void *devPacked;
+        aclTensor *tensor;
+    };
+
+    PackedWeightCache(const PackedWeightCache &) = delete;
+    PackedWeightCache &operator=(const PackedWeightCache &) = delete;
+
+    static void Release(Entry &entry);
+
+    std::map<const void *, Entry> entries_;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+};
+
+#endif // WEIGHT_CACHE_H
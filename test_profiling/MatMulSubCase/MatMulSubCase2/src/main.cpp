@@ -20,6 +20,10 @@
 
 bool g_isDevice = false;
 int deviceId = 0;
+// 运行参数：x2_stationary 开启常量权重缓存，bench 输出冷/热调用耗时
+bool g_x2Stationary = false;
+bool g_benchmark = false;
+constexpr size_t BENCH_LOOPS = 20;
 
 OperatorDesc CreateOpDesc()
 {
@@ -119,6 +123,7 @@ bool RunOp()
 {
     // create op desc
     OperatorDesc opDesc = CreateOpDesc();
+    opDesc.x2Stationary = g_x2Stationary;
 
     // create Runner
     OpRunner opRunner(&opDesc);
@@ -145,12 +150,28 @@ bool RunOp()
         return false;
     }
 
+    if (g_benchmark && !opRunner.BenchmarkOp(BENCH_LOOPS)) {
+        ERROR_LOG("Benchmark op failed");
+        return false;
+    }
+
     INFO_LOG("Run op success");
     return true;
 }
 
 int main(int argc, char **argv)
 {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "x2_stationary") {
+            g_x2Stationary = true;
+        } else if (arg == "bench") {
+            g_benchmark = true;
+        } else {
+            WARN_LOG("Unknown argument %s", argv[i]);
+        }
+    }
+
     if (!InitResource()) {
         ERROR_LOG("Init resource failed");
         return FAILED;
@@ -0,0 +1,124 @@
+/**
+* @file weight_cache.cpp
+*
+* Copyright (C) 2023. Huawei Technologies Co., Ltd. All rights reserved.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+*/
+#include "weight_cache.h"
+
+#include <cstring>
+#include <vector>
+
+#include "common.h"
+
+extern bool g_isDevice;
+
+namespace {
+constexpr int64_t FRACTAL_K = 16;
+constexpr int64_t BLOCK_BYTES = 32;
+
+// ND [k, n] -> NZ [n1, k1, 16, c0]，K 方向补齐到 16，N 方向补齐到 c0，补齐部分填 0
+void PackNdToNz(const uint8_t *src, uint8_t *dst, size_t typeSize, int64_t k, int64_t n, int64_t k1, int64_t c0)
+{
+    for (int64_t row = 0; row < k; ++row) {
+        for (int64_t col = 0; col < n; ++col) {
+            int64_t dstIdx = ((col / c0) * k1 * FRACTAL_K + row) * c0 + col % c0;
+            std::memcpy(dst + dstIdx * typeSize, src + (row * n + col) * typeSize, typeSize);
+        }
+    }
+}
+} // namespace
+
+PackedWeightCache::~PackedWeightCache()
+{
+    Clear();
+}
+
+aclTensor *PackedWeightCache::Acquire(const void *devAddr, uint64_t version, const void *hostData,
+                                      aclDataType dataType, const std::vector<int64_t> &shape)
+{
+    auto it = entries_.find(devAddr);
+    if (it != entries_.end()) {
+        if (it->second.version == version) {
+            hits_++;
+            return it->second.tensor;
+        }
+        // 权重内容已更新，旧的分形数据作废
+        Release(it->second);
+        entries_.erase(it);
+    }
+    misses_++;
+
+    size_t typeSize = aclDataTypeSize(dataType);
+    if (typeSize == 0 || hostData == nullptr || shape.size() < 2) {
+        ERROR_LOG("Pack weight failed. dataType = %d", static_cast<int32_t>(dataType));
+        return nullptr;
+    }
+    size_t rank = shape.size();
+    int64_t batch = 1;
+    for (size_t i = 0; i + 2 < rank; ++i) {
+        batch *= shape[i];
+    }
+    int64_t k = shape[rank - 2];
+    int64_t n = shape[rank - 1];
+    int64_t c0 = BLOCK_BYTES / static_cast<int64_t>(typeSize);
+    int64_t k1 = (k + FRACTAL_K - 1) / FRACTAL_K;
+    int64_t n1 = (n + c0 - 1) / c0;
+    size_t matrixBytes = static_cast<size_t>(n1 * k1 * FRACTAL_K * c0) * typeSize;
+    size_t packedSize = static_cast<size_t>(batch) * matrixBytes;
+
+    // 每个 batch 独立重排，batch 之间首尾相接
+    std::vector<uint8_t> packed(packedSize, 0);
+    const uint8_t *src = static_cast<const uint8_t *>(hostData);
+    for (int64_t b = 0; b < batch; ++b) {
+        PackNdToNz(src + b * k * n * typeSize, packed.data() + b * matrixBytes, typeSize, k, n, k1, c0);
+    }
+
+    Entry entry{version, nullptr, nullptr};
+    if (aclrtMalloc(&entry.devPacked, packedSize, ACL_MEM_MALLOC_HUGE_FIRST) != ACL_SUCCESS) {
+        ERROR_LOG("Malloc device memory for packed weight failed");
+        return nullptr;
+    }
+    aclrtMemcpyKind kind = g_isDevice ? ACL_MEMCPY_DEVICE_TO_DEVICE : ACL_MEMCPY_HOST_TO_DEVICE;
+    if (aclrtMemcpy(entry.devPacked, packedSize, packed.data(), packedSize, kind) != ACL_SUCCESS) {
+        ERROR_LOG("Copy packed weight failed");
+        Release(entry);
+        return nullptr;
+    }
+
+    std::vector<int64_t> storageShape(shape.begin(), shape.end() - 2);
+    storageShape.insert(storageShape.end(), {n1, k1, FRACTAL_K, c0});
+    entry.tensor = aclCreateTensor(shape.data(), shape.size(), dataType, nullptr, 0,
+        ACL_FORMAT_FRACTAL_NZ, storageShape.data(), storageShape.size(), entry.devPacked);
+    if (entry.tensor == nullptr) {
+        ERROR_LOG("Create Tensor for packed weight failed");
+        Release(entry);
+        return nullptr;
+    }
+    INFO_LOG("Pack weight to FRACTAL_NZ success, packed size %zu", packedSize);
+    entries_.emplace(devAddr, entry);
+    return entry.tensor;
+}
+
+void PackedWeightCache::Clear()
+{
+    for (auto &item : entries_) {
+        Release(item.second);
+    }
+    entries_.clear();
+}
+
+void PackedWeightCache::Release(Entry &entry)
+{
+    if (entry.tensor != nullptr) {
+        (void)aclDestroyTensor(entry.tensor);
+        entry.tensor = nullptr;
+    }
+    if (entry.devPacked != nullptr) {
+        (void)aclrtFree(entry.devPacked);
+        entry.devPacked = nullptr;
+    }
+}
@@ -52,6 +52,10 @@ struct OperatorDesc {
     int64_t dimension;
 
     bool keep_dims;
+    // x2 为常量权重时置为 true，首次调用后复用预先重排好的 NZ 权重
+    bool x2Stationary;
+    bool transposeX1;
+    bool transposeX2;
     std::string opType;
     std::vector<aclTensorDesc *> inputDesc;
     std::vector<aclTensorDesc *> outputDesc;
@@ -12,7 +12,7 @@
 
 using namespace std;
 
-OperatorDesc::OperatorDesc() {}
+OperatorDesc::OperatorDesc() : x2Stationary(false), transposeX1(false), transposeX2(false) {}
 
 OperatorDesc::~OperatorDesc()
 {
@@ -14,6 +14,7 @@
 #include "acl/acl.h"
 #include "common.h"
 #include "operator_desc.h"
+#include "weight_cache.h"
 
 /**
  * Op Runner
@@ -161,7 +162,22 @@ public:
      */
     bool RunOp();
 
+    /**
+     * @brief Run op repeatedly and print cold and warm latency
+     * @param [in] loops: number of warm runs
+     * @return run result
+     */
+    bool BenchmarkOp(size_t loops);
+
+    /**
+     * @brief Mark x2 as modified, the packed weight will be rebuilt on next run
+     */
+    void UpdateWeight();
+
 private:
+    bool LaunchOp(aclrtStream stream);
+
+
     size_t numInputs_;
     size_t numOutputs_;
 
@@ -177,6 +193,9 @@ private:
     std::vector<aclTensor *> inputTensor_;
     std::vector<aclTensor *> outputTensor_;
     OperatorDesc *opDesc_;
+
+    PackedWeightCache weightCache_;
+    uint64_t x2Version_ = 0;
 };
 
 #endif // OP_RUNNER_H
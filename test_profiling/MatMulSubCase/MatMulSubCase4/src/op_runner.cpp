@@ -11,6 +11,7 @@
 #include "aclnn_mat_mul_sub.h"
 #include <limits>
 #include <cassert>
+#include <chrono>
 #include "acl/acl_op_compiler.h"
 #include "common.h"
 
@@ -337,59 +338,121 @@ bool OpRunner::RunOp()
     }
     INFO_LOG("Create stream success");
 
-    size_t workspaceSize = 0;
-	aclOpExecutor *handle = nullptr;
+    if (!LaunchOp(stream)) {
+        (void)aclrtDestroyStream(stream);
+        return false;
+    }
 
-    auto ret = aclnnMatMulSubGetWorkspaceSize(inputTensor_[0],  inputTensor_[1], inputTensor_[2], 
-                                                      outputTensor_[0], &workspaceSize, &handle);
+    for (size_t i = 0; i < numOutputs_; ++i) {
+        auto size = GetOutputSize(i);
+        aclrtMemcpyKind kind = ACL_MEMCPY_DEVICE_TO_HOST;
+        if (g_isDevice) {
+            kind = ACL_MEMCPY_DEVICE_TO_DEVICE;
+        }
+        if (aclrtMemcpy(hostOutputs_[i], size, devOutputs_[i], size, kind) != ACL_SUCCESS) {
+            INFO_LOG("Copy output[%zu] success", i);
+            (void)aclrtDestroyStream(stream);
+            return false;
+        }
+        INFO_LOG("Copy output[%zu] success", i);
+    }
+
+    (void)aclrtDestroyStream(stream);
+    return true;
+}
+
+bool OpRunner::LaunchOp(aclrtStream stream)
+{
+    // 常量权重模式下 x2 换成缓存中的 NZ 张量，命中时不再做格式转换
+    aclTensor *x2Tensor = inputTensor_[1];
+    if (opDesc_->x2Stationary) {
+        x2Tensor = weightCache_.Acquire(devInputs_[1], x2Version_, hostInputs_[1], GetInputDataType(1),
+                                        GetInputShape(1));
+        if (x2Tensor == nullptr) {
+            ERROR_LOG("Get packed weight failed");
+            return false;
+        }
+    }
+
+    size_t workspaceSize = 0;
+    aclOpExecutor *handle = nullptr;
+    auto ret = aclnnMatMulSubGetWorkspaceSize(inputTensor_[0], x2Tensor, inputTensor_[2], opDesc_->transposeX1,
+                                              opDesc_->transposeX2, outputTensor_[0], &workspaceSize, &handle);
     if (ret != ACL_SUCCESS) {
-        (void)aclrtDestroyStream(stream);
         ERROR_LOG("Get Operator Workspace failed. error code is %d", static_cast<int32_t>(ret));
         return false;
     }
-	INFO_LOG("Execute GetWorkspaceSize success, workspace size %lu", workspaceSize);
-    
+    INFO_LOG("Execute GetWorkspaceSize success, workspace size %lu", workspaceSize);
+
     void *workspace = nullptr;
     if (workspaceSize != 0) {
         if (aclrtMalloc(&workspace, workspaceSize, ACL_MEM_MALLOC_HUGE_FIRST) != ACL_SUCCESS) {
             ERROR_LOG("Malloc device memory failed");
+            return false;
         }
     }
     ret = aclnnMatMulSub(workspace, workspaceSize, handle, stream);
-
     if (ret != ACL_SUCCESS) {
-        (void)aclrtDestroyStream(stream);
+        if (workspace != nullptr) {
+            (void)aclrtFree(workspace);
+        }
         ERROR_LOG("Execute Operator failed. error code is %d", static_cast<int32_t>(ret));
         return false;
     }
-	INFO_LOG("Execute Operator success");
+    INFO_LOG("Execute Operator success");
 
     ret = aclrtSynchronizeStreamWithTimeout(stream, 5000);
+    if (workspace != nullptr) {
+        (void)aclrtFree(workspace);
+    }
     if (ret != SUCCESS) {
         ERROR_LOG("Synchronize stream failed. error code is %d", static_cast<int32_t>(ret));
-        (void)aclrtDestroyStream(stream);
         return false;
     }
     INFO_LOG("Synchronize stream success");
+    return true;
+}
 
-    for (size_t i = 0; i < numOutputs_; ++i) {
-        auto size = GetOutputSize(i);
-        aclrtMemcpyKind kind = ACL_MEMCPY_DEVICE_TO_HOST;
-        if (g_isDevice) {
-            kind = ACL_MEMCPY_DEVICE_TO_DEVICE;
-        }
-        if (aclrtMemcpy(hostOutputs_[i], size, devOutputs_[i], size, kind) != ACL_SUCCESS) {
-            INFO_LOG("Copy output[%zu] success", i);
+bool OpRunner::BenchmarkOp(size_t loops)
+{
+    aclrtStream stream = nullptr;
+    if (aclrtCreateStream(&stream) != ACL_SUCCESS) {
+        ERROR_LOG("Create stream failed");
+        return false;
+    }
+
+    // 冷启动：清空缓存，首次调用包含 x2 的 NZ 重排与搬运
+    weightCache_.Clear();
+    auto start = std::chrono::steady_clock::now();
+    if (!LaunchOp(stream)) {
+        (void)aclrtDestroyStream(stream);
+        return false;
+    }
+    auto end = std::chrono::steady_clock::now();
+    double coldUs = std::chrono::duration<double, std::micro>(end - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < loops; ++i) {
+        if (!LaunchOp(stream)) {
             (void)aclrtDestroyStream(stream);
             return false;
         }
-        INFO_LOG("Copy output[%zu] success", i);
     }
+    end = std::chrono::steady_clock::now();
+    double warmUs = loops == 0 ? 0.0 : std::chrono::duration<double, std::micro>(end - start).count() / loops;
 
+    INFO_LOG("Benchmark x2_stationary=%d, cold %.2f us, warm %.2f us (avg of %zu), cache hit %lu miss %lu",
+             static_cast<int32_t>(opDesc_->x2Stationary), coldUs, warmUs, loops,
+             weightCache_.Hits(), weightCache_.Misses());
     (void)aclrtDestroyStream(stream);
     return true;
 }
 
+void OpRunner::UpdateWeight()
+{
+    x2Version_++;
+}
+
 
 template<typename T>
 void DoPrintData(const T *data, size_t count, size_t elementsPerRow)
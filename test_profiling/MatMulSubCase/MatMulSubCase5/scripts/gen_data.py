@@ -0,0 +1,25 @@
+import numpy as np
+import os
+
+
+
+def gen_golden_data_simple():
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    input_x1 = np.random.uniform(-1, 1, [96,64]).astype(np.float16)
+    input_x2 = np.random.uniform(-1, 1, [64,100]).astype(np.float16)
+    input_x3 = np.random.uniform(-1, 1, [100]).astype(np.float16)
+
+    input_x1.tofile("./input/input_x1.bin")
+    input_x2.tofile("./input/input_x2.bin")
+    input_x3.tofile("./input/input_x3.bin")
+    # 核内以 fp32 累加并减去 x3，真值同样按 fp32 计算后转回 fp16
+    golden = (np.matmul(input_x1.astype(np.float32), input_x2.astype(np.float32)) -
+              input_x3.astype(np.float32)).astype(np.float16)
+
+    golden.tofile("./output/golden.bin")
+
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
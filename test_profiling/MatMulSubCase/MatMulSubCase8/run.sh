@@ -0,0 +1,119 @@
+#!/bin/bash
+export ASCEND_SLOG_PRINT_TO_STDOUT=0
+export ASCEND_GLOBAL_LOG_LEVEL=1
+
+CURRENT_DIR=$(
+    cd $(dirname ${BASH_SOURCE:-$0})
+    pwd
+)
+cd $CURRENT_DIR
+
+# 导出环境变量
+SHORT=v:,
+LONG=dtype:,
+OPTS=$(getopt -a --options $SHORT --longoptions $LONG -- "$@")
+eval set -- "$OPTS"
+while :
+do
+    case "$1" in
+        # float16, float, int32
+        (-v | --dtype)
+            DTYPE="$2"
+            shift 2;;
+        (--)
+            shift;
+            break;;
+        (*)
+            echo "[ERROR] Unexpected option: $1";
+            break;;
+    esac
+done
+
+if [ ! $ASCEND_HOME_DIR ]; then
+    if [ -d "$HOME/Ascend/ascend-toolkit/latest" ]; then
+        export ASCEND_HOME_DIR=$HOME/Ascend/ascend-toolkit/latest
+    else
+        export ASCEND_HOME_DIR=/usr/local/Ascend/ascend-toolkit/latest
+    fi
+fi
+source $ASCEND_HOME_DIR/bin/setenv.bash
+
+export DDK_PATH=$ASCEND_HOME_DIR
+arch=$(uname -m)
+export NPU_HOST_LIB=$ASCEND_HOME_DIR/${arch}-linux/lib64
+
+function main {
+    # 1. 清除算子输出和日志文件
+    
+    # rm ./input/*.bin
+    rm -rf ./output/output*.bin > /dev/null
+
+    # 2. 生成或复用输入数据和真值数据 
+    if [ -d "./input" ]; then
+        if [ "$(ls -A "./input")" ]; then
+        echo "已存在测试数据"
+        else
+            echo "生成测试数据"
+            cd $CURRENT_DIR
+            python3 scripts/gen_data.py
+        fi
+    else
+        echo "生成测试数据"
+        cd $CURRENT_DIR
+        python3 scripts/gen_data.py
+    fi
+
+    if [ $? -ne 0 ]; then
+        echo "ERROR: generate input data failed!"
+        return 1
+    fi
+    echo "INFO: generate input data success!"
+
+    # 3. 编译或复用acl可执行文件
+    if [ -e "./output/execute_op" ]; then
+        echo "可执行存在"
+    else
+        echo "可执行不存在"
+        cd $CURRENT_DIR; rm -rf build; mkdir -p build; cd build
+        cmake ../src
+        if [ $? -ne 0 ]; then
+            echo "ERROR: cmake failed!"
+            return 1
+        fi
+        echo "INFO: cmake success!"
+        make
+        if [ $? -ne 0 ]; then
+            echo "ERROR: make failed!"
+            return 1
+        fi
+        echo "INFO: make success!"
+    fi
+
+    # 4. 运行可执行文件
+    cd $CURRENT_DIR/output
+    echo "INFO: execute op!"
+    # 常量权重模式：首次调用打包 NZ 权重(冷)，第二次命中缓存(热)
+    timeout 30 ./execute_op x2_stationary
+
+    if [ $? -ne 0 ]; then
+        echo "ERROR: acl executable run failed! please check your project!"
+        return 1
+    fi
+    echo "INFO: acl executable run success!"
+
+    # 5. 比较真值文件
+    cd $CURRENT_DIR
+    ret=`python3 scripts/verify_result.py output/output.bin output/golden.bin`
+    warm_ret=`python3 scripts/verify_result.py output/output_warm.bin output/golden.bin`
+    echo "verify cold $ret"
+    echo "verify warm $warm_ret"
+    if [ "x$ret" == "xtest pass" ] && [ "x$warm_ret" == "xtest pass" ]; then
+        echo ""
+        echo "#####################################"
+        echo "INFO: you have passed the Precision!"
+        echo "#####################################"
+        echo ""
+    fi
+}
+
+main
@@ -161,7 +161,18 @@ public:
      */
     bool RunOp();
 
+    /**
+     * @brief Run op repeatedly in fast and deterministic mode, print latency and bitwise stability
+     * @param [in] loops: number of timed runs in each mode
+     * @return run result
+     */
+    bool BenchmarkOp(size_t loops);
+
 private:
+    bool LaunchOp(aclrtStream stream);
+
+    bool TimeLaunch(aclrtStream stream, size_t loops, double &avgUs, bool &stable);
+
     size_t numInputs_;
     size_t numOutputs_;
 
@@ -11,6 +11,8 @@
 #include "aclnn_nll_loss.h"
 #include <limits>
 #include <cassert>
+#include <chrono>
+#include <cstring>
 #include "acl/acl_op_compiler.h"
 #include "common.h"
 
@@ -337,59 +339,145 @@ bool OpRunner::RunOp()
     }
     INFO_LOG("Create stream success");
 
+    if (!LaunchOp(stream)) {
+        (void)aclrtDestroyStream(stream);
+        return false;
+    }
+
+    for (size_t i = 0; i < numOutputs_; ++i) {
+        auto size = GetOutputSize(i);
+        aclrtMemcpyKind kind = ACL_MEMCPY_DEVICE_TO_HOST;
+        if (g_isDevice) {
+            kind = ACL_MEMCPY_DEVICE_TO_DEVICE;
+        }
+        if (aclrtMemcpy(hostOutputs_[i], size, devOutputs_[i], size, kind) != ACL_SUCCESS) {
+            INFO_LOG("Copy output[%zu] success", i);
+            (void)aclrtDestroyStream(stream);
+            return false;
+        }
+        INFO_LOG("Copy output[%zu] success", i);
+    }
+
+    (void)aclrtDestroyStream(stream);
+    return true;
+}
+
+
+bool OpRunner::LaunchOp(aclrtStream stream)
+{
     size_t workspaceSize = 0;
-	aclOpExecutor *handle = nullptr;
-    
-	auto ret = aclnnNLLLossGetWorkspaceSize(inputTensor_[0], inputTensor_[1],inputTensor_[2],opDesc_->reduction,opDesc_->ignore_index, outputTensor_[0], &workspaceSize, &handle);
+    aclOpExecutor *handle = nullptr;
+    auto ret = aclnnNLLLossGetWorkspaceSize(inputTensor_[0], inputTensor_[1], inputTensor_[2], opDesc_->reduction,
+                                            opDesc_->ignore_index, outputTensor_[0], &workspaceSize, &handle);
     if (ret != ACL_SUCCESS) {
-        (void)aclrtDestroyStream(stream);
         ERROR_LOG("Get Operator Workspace failed. error code is %d", static_cast<int32_t>(ret));
         return false;
     }
-	INFO_LOG("Execute GetWorkspaceSize success, workspace size %lu", workspaceSize);
-    
+    INFO_LOG("Execute GetWorkspaceSize success, workspace size %lu", workspaceSize);
+
     void *workspace = nullptr;
     if (workspaceSize != 0) {
         if (aclrtMalloc(&workspace, workspaceSize, ACL_MEM_MALLOC_HUGE_FIRST) != ACL_SUCCESS) {
             ERROR_LOG("Malloc device memory failed");
+            return false;
         }
     }
     ret = aclnnNLLLoss(workspace, workspaceSize, handle, stream);
-
     if (ret != ACL_SUCCESS) {
-        (void)aclrtDestroyStream(stream);
+        if (workspace != nullptr) {
+            (void)aclrtFree(workspace);
+        }
         ERROR_LOG("Execute Operator failed. error code is %d", static_cast<int32_t>(ret));
         return false;
     }
-	INFO_LOG("Execute Operator success");
+    INFO_LOG("Execute Operator success");
 
     ret = aclrtSynchronizeStreamWithTimeout(stream, 5000);
+    if (workspace != nullptr) {
+        (void)aclrtFree(workspace);
+    }
     if (ret != SUCCESS) {
         ERROR_LOG("Synchronize stream failed. error code is %d", static_cast<int32_t>(ret));
-        (void)aclrtDestroyStream(stream);
         return false;
     }
     INFO_LOG("Synchronize stream success");
+    return true;
+}
 
-    for (size_t i = 0; i < numOutputs_; ++i) {
-        auto size = GetOutputSize(i);
-        aclrtMemcpyKind kind = ACL_MEMCPY_DEVICE_TO_HOST;
-        if (g_isDevice) {
-            kind = ACL_MEMCPY_DEVICE_TO_DEVICE;
+bool OpRunner::TimeLaunch(aclrtStream stream, size_t loops, double &avgUs, bool &stable)
+{
+    // 预热一次并记录输出，作为逐位比较的基准
+    if (!LaunchOp(stream)) {
+        return false;
+    }
+    size_t size = GetOutputSize(0);
+    aclrtMemcpyKind kind = g_isDevice ? ACL_MEMCPY_DEVICE_TO_DEVICE : ACL_MEMCPY_DEVICE_TO_HOST;
+    std::vector<uint8_t> reference(size);
+    std::vector<uint8_t> current(size);
+    if (aclrtMemcpy(reference.data(), size, devOutputs_[0], size, kind) != ACL_SUCCESS) {
+        ERROR_LOG("Copy output failed");
+        return false;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < loops; ++i) {
+        if (!LaunchOp(stream)) {
+            return false;
         }
-        if (aclrtMemcpy(hostOutputs_[i], size, devOutputs_[i], size, kind) != ACL_SUCCESS) {
-            INFO_LOG("Copy output[%zu] success", i);
-            (void)aclrtDestroyStream(stream);
+    }
+    auto end = std::chrono::steady_clock::now();
+    avgUs = loops == 0 ? 0.0 : std::chrono::duration<double, std::micro>(end - start).count() / loops;
+
+    stable = true;
+    for (size_t i = 0; i < loops; ++i) {
+        if (!LaunchOp(stream)) {
             return false;
         }
-        INFO_LOG("Copy output[%zu] success", i);
+        if (aclrtMemcpy(current.data(), size, devOutputs_[0], size, kind) != ACL_SUCCESS) {
+            ERROR_LOG("Copy output failed");
+            return false;
+        }
+        stable = stable && memcmp(reference.data(), current.data(), size) == 0;
     }
+    return true;
+}
 
+bool OpRunner::BenchmarkOp(size_t loops)
+{
+    aclrtStream stream = nullptr;
+    if (aclrtCreateStream(&stream) != ACL_SUCCESS) {
+        ERROR_LOG("Create stream failed");
+        return false;
+    }
+
+    double fastUs = 0.0;
+    bool fastStable = false;
+    if (!TimeLaunch(stream, loops, fastUs, fastStable)) {
+        (void)aclrtDestroyStream(stream);
+        return false;
+    }
+
+    // 打开确定性计算开关后，部分和按固定分段与树形顺序合并
+    if (aclrtCtxSetSysParamOpt(ACL_OPT_DETERMINISTIC, 1) != ACL_SUCCESS) {
+        ERROR_LOG("Enable deterministic mode failed");
+        (void)aclrtDestroyStream(stream);
+        return false;
+    }
+    double detUs = 0.0;
+    bool detStable = false;
+    bool ret = TimeLaunch(stream, loops, detUs, detStable);
+    (void)aclrtCtxSetSysParamOpt(ACL_OPT_DETERMINISTIC, 0);
     (void)aclrtDestroyStream(stream);
+    if (!ret) {
+        return false;
+    }
+
+    INFO_LOG("Benchmark reduction=%s, fast %.2f us (bitwise stable %d), deterministic %.2f us (bitwise stable %d), "
+             "avg of %zu", opDesc_->reduction, fastUs, static_cast<int32_t>(fastStable), detUs,
+             static_cast<int32_t>(detStable), loops);
     return true;
 }
 
-
 template<typename T>
 void DoPrintData(const T *data, size_t count, size_t elementsPerRow)
 {
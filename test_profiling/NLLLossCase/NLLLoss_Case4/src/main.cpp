@@ -9,6 +9,7 @@
 */
 #include <cstdint>
 #include <iostream>
+#include <string>
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -20,6 +21,9 @@
 
 bool g_isDevice = false;
 int deviceId = 0;
+// 运行参数：bench 输出快速模式与确定性模式的耗时及多次运行结果是否逐位一致
+bool g_benchmark = false;
+constexpr size_t BENCH_LOOPS = 20;
 
 OperatorDesc CreateOpDesc()
 {
@@ -150,12 +154,26 @@ bool RunOp()
         return false;
     }
 
+    if (g_benchmark && !opRunner.BenchmarkOp(BENCH_LOOPS)) {
+        ERROR_LOG("Benchmark op failed");
+        return false;
+    }
+
     INFO_LOG("Run op success");
     return true;
 }
 
 int main(int argc, char **argv)
 {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "bench") {
+            g_benchmark = true;
+        } else {
+            WARN_LOG("Unknown argument %s", argv[i]);
+        }
+    }
+
     if (!InitResource()) {
         ERROR_LOG("Init resource failed");
         return FAILED;
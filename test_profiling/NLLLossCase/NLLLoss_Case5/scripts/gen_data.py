@@ -0,0 +1,32 @@
+import torch
+import torch.nn as nn
+import numpy as np
+import os    
+def gen_golden_data_simple():    
+    test_type = np.float32
+    target_type = np.int32
+    input_x = np.random.uniform(-5, 5,[64,40] ).astype(test_type)
+    input_target = np.random.uniform(0,40,[64] ).astype(target_type)
+    input_weight= np.random.uniform(0,1,[40] ).astype(test_type)
+    grad_y = np.random.uniform(0.5, 2,[1] ).astype(test_type)
+    reduction="mean";
+    ignore_index=-100;
+    # 部分样本取 ignore_index，其梯度行应全为 0
+    input_target[::7] = ignore_index
+    x = torch.tensor(input_x, requires_grad=True)
+    res = torch.nn.functional.nll_loss(x, torch.Tensor(input_target).to(torch.long), weight=torch.Tensor(input_weight), size_average=None, 
+                                       ignore_index=ignore_index, reduce=None, reduction=reduction)
+    res.backward(torch.tensor(grad_y[0]))
+    golden = x.grad.numpy().astype(test_type)
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    grad_y.tofile("./input/grad_y.bin")
+    input_x.tofile("./input/input_x.bin")
+    input_target.tofile("./input/target.bin")
+    input_weight.tofile("./input/weight.bin")
+    golden.tofile("./output/golden.bin")
+
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
\ No newline at end of file
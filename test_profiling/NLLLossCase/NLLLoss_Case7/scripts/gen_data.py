@@ -0,0 +1,29 @@
+import torch
+import torch.nn as nn
+import numpy as np
+import os    
+def gen_golden_data_simple():    
+    test_type = np.float32
+    target_type = np.int32
+    # C >= 2048 且 N * C 超出单核上限，按 target 从 GM 逐个取 x[i, target[i]](tiling key 3)
+    input_x = np.random.uniform(-5, 5,[512,32000] ).astype(test_type)
+    input_target = np.random.uniform(0,31999,[512] ).astype(target_type)
+    input_weight= np.random.uniform(0,1,[32000] ).astype(test_type)
+    reduction="mean";
+    ignore_index=-100;
+    # 部分样本取 ignore_index，不计入 loss 与 weight 之和
+    input_target[::5] = ignore_index
+    res = torch.nn.functional.nll_loss(torch.Tensor(input_x), torch.Tensor(input_target).to(torch.long), weight=torch.Tensor(input_weight), size_average=None, 
+                                       ignore_index=ignore_index, reduce=None, reduction=reduction)
+    golden = res.numpy().astype(test_type)
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    input_x.tofile("./input/input_x.bin")
+    input_target.tofile("./input/target.bin")
+    input_weight.tofile("./input/weight.bin")
+    golden.tofile("./output/golden.bin")
+
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
\ No newline at end of file
@@ -0,0 +1,37 @@
+import numpy as np
+import os
+np.random.seed(143)
+
+
+# 第 i 段为 x[offsets[i], offsets[i + 1])；indices 为段内第一个最大值的位置，空段为 -1，其 values 为 0
+def segment_arg_max(x, offsets):
+    segment_num = offsets.size - 1
+    indice = np.full([segment_num], -1, dtype=np.int32)
+    values = np.zeros([segment_num], dtype=x.dtype)
+    for i in range(segment_num):
+        segment = x[offsets[i]:offsets[i + 1]]
+        if segment.size > 0:
+            indice[i] = np.argmax(segment)
+            values[i] = segment[indice[i]]
+    return indice, values
+
+
+def gen_golden_data_simple():
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    # 每核至少 8192 个元素，200000 个元素分到 25 个核：
+    # 开头、中间与末尾各有空段，三个长段各跨多个核，另有长度为 1 与 3 的短段
+    x = np.random.uniform(-10, 10, [200000]).astype(np.float32)
+    offsets = np.array([0, 0, 3, 3, 61000, 61000, 61001, 140000, 199999, 200000, 200000], dtype=np.int32)
+    # 跨核的段中最大值出现在两个核上，应取前一个核中的位置
+    x[61001 + 8192 * 3 + 5] = 100.0
+    x[61001 + 8192 * 6] = 100.0
+    x.tofile("./input/input_x.bin")
+    offsets.tofile("./input/input_offsets.bin")
+    indice, values = segment_arg_max(x, offsets)
+    indice.tofile("./output/golden_indice.bin")
+    values.tofile("./output/golden_values.bin")
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
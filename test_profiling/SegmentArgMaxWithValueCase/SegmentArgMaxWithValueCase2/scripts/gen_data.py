@@ -0,0 +1,36 @@
+import numpy as np
+import os
+np.random.seed(143)
+
+
+# 第 i 段为 x[offsets[i], offsets[i + 1])；indices 为段内第一个最大值的位置，空段为 -1，其 values 为 0
+def segment_arg_max(x, offsets):
+    segment_num = offsets.size - 1
+    indice = np.full([segment_num], -1, dtype=np.int32)
+    values = np.zeros([segment_num], dtype=x.dtype)
+    for i in range(segment_num):
+        segment = x[offsets[i]:offsets[i + 1]]
+        if segment.size > 0:
+            indice[i] = np.argmax(segment)
+            values[i] = segment[indice[i]]
+    return indice, values
+
+
+def gen_golden_data_simple():
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    # 100000 个长度为 0 到 4 的短段(含空段)，总长 200000，大量段的边界落在核的边界两侧
+    lengths = np.arange(100000) % 5
+    np.random.shuffle(lengths)
+    offsets = np.concatenate([[0], np.cumsum(lengths)]).astype(np.int32)
+    # 取值较少，短段内也会出现并列的最大值
+    x = np.random.randint(-8, 8, [200000]).astype(np.float16)
+    x.tofile("./input/input_x.bin")
+    offsets.tofile("./input/input_offsets.bin")
+    indice, values = segment_arg_max(x, offsets)
+    indice.tofile("./output/golden_indice.bin")
+    values.tofile("./output/golden_values.bin")
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
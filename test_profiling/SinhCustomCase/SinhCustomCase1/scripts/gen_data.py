@@ -0,0 +1,22 @@
+import numpy as np
+import os
+np.random.seed(143)
+
+
+def gen_golden_data_simple():
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    # fp16 在 |x| > 11.78 时 sinh 上溢，边界取 ±11.75
+    size = 16384
+    limit = 11.75
+    x = np.concatenate([np.random.uniform(-1, 1, size // 4),
+                        np.random.uniform(-limit, limit, size - size // 4 - 4),
+                        np.array([limit, -limit, 0.0, -1e-4])]).astype(np.float16).reshape([8, 2048])
+    x.tofile("./input/input_x.bin")
+    # 真值按量化后的输入在 float64 下计算
+    x64 = x.astype(np.float64)
+    np.sinh(x64).astype(np.float16).tofile("./output/golden_sinh.bin")
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
@@ -0,0 +1,36 @@
+import numpy as np
+import os
+np.random.seed(143)
+
+
+# bf16 按 uint16 存放：float32 的高 16 位，舍入到最近偶数
+def to_bf16(x):
+    bits = x.astype(np.float32).view(np.uint32)
+    bits = bits + 0x7FFF + ((bits >> 16) & 1)
+    return (bits >> 16).astype(np.uint16)
+
+
+def from_bf16(x):
+    return (x.astype(np.uint32) << 16).view(np.float32)
+
+
+def gen_golden_data_simple():
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    # bf16 与 fp32 的指数范围相同，边界取 ±89；同时输出 sinh、cosh、tanh
+    size = 4096
+    limit = 89.0
+    x = np.concatenate([np.random.uniform(-1, 1, size // 4),
+                        np.random.uniform(-limit, limit, size - size // 4 - 4),
+                        np.array([limit, -limit, 0.0, -1e-4])]).astype(np.float32)
+    x = to_bf16(x).reshape([4096])
+    x.tofile("./input/input_x.bin")
+    # 真值按量化后的输入在 float64 下计算
+    x64 = from_bf16(x).astype(np.float64)
+    to_bf16(np.sinh(x64).astype(np.float32)).tofile("./output/golden_sinh.bin")
+    to_bf16(np.cosh(x64).astype(np.float32)).tofile("./output/golden_cosh.bin")
+    to_bf16(np.tanh(x64).astype(np.float32)).tofile("./output/golden_tanh.bin")
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
@@ -0,0 +1,27 @@
+import numpy as np
+import os
+np.random.seed(143)
+
+
+# 沿 dimension 取前 k 个，按从优到劣排列，值相等时索引小的在前
+def top_k(x, k, dimension, largest):
+    moved = np.moveaxis(x, dimension, -1)
+    order = np.argsort(-moved if largest else moved, axis=-1, kind="stable")[..., :k]
+    values = np.take_along_axis(moved, order, axis=-1)
+    return np.moveaxis(order, -1, dimension).astype(np.int32), np.moveaxis(values, -1, dimension)
+
+
+def gen_golden_data_simple():
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    # 沿中间维归约(ROW)：每个 lane 为一列，各行逐个插入候选
+    # 取值只有 16 种，每列的最小值与次小值大量并列
+    x = np.random.randint(-8, 8, [8, 1024, 16]).astype(np.float16)
+    x.tofile("./input/input_x.bin")
+    indice, values = top_k(x, 4, 1, False)
+    indice.tofile("./output/golden_indice.bin")
+    values.tofile("./output/golden_values.bin")
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
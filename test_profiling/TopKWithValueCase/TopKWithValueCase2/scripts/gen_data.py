@@ -0,0 +1,27 @@
+import numpy as np
+import os
+np.random.seed(143)
+
+
+# 沿 dimension 取前 k 个，按从优到劣排列，值相等时索引小的在前
+def top_k(x, k, dimension, largest):
+    moved = np.moveaxis(x, dimension, -1)
+    order = np.argsort(-moved if largest else moved, axis=-1, kind="stable")[..., :k]
+    values = np.take_along_axis(moved, order, axis=-1)
+    return np.moveaxis(order, -1, dimension).astype(np.int32), np.moveaxis(values, -1, dimension)
+
+
+def gen_golden_data_simple():
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    # 沿末维归约且行数多(GATHER)：每个 lane 为一行
+    # 取值只有 32 种，前 8 个中大量并列
+    x = np.random.randint(-16, 16, [4096, 500]).astype(np.float16)
+    x.tofile("./input/input_x.bin")
+    indice, values = top_k(x, 8, 1, True)
+    indice.tofile("./output/golden_indice.bin")
+    values.tofile("./output/golden_values.bin")
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()
@@ -0,0 +1,31 @@
+import numpy as np
+import os
+np.random.seed(143)
+
+
+# 沿 dimension 取前 k 个，按从优到劣排列，值相等时索引小的在前
+def top_k(x, k, dimension, largest):
+    moved = np.moveaxis(x, dimension, -1)
+    order = np.argsort(-moved if largest else moved, axis=-1, kind="stable")[..., :k]
+    values = np.take_along_axis(moved, order, axis=-1)
+    return np.moveaxis(order, -1, dimension).astype(np.int32), np.moveaxis(values, -1, dimension)
+
+
+def gen_golden_data_simple():
+    os.system("mkdir -p input")
+    os.system("mkdir -p output")
+    # 沿末维归约(GATHER)，列数不按 32 字节对齐
+    # 每行的最小值复制到另外两个位置，与其他候选并列
+    x = np.random.uniform(-100, 100, [1000, 777]).astype(np.float32)
+    rows = np.arange(1000)
+    row_min = x.min(axis=1)
+    x[rows, (rows * 7) % 777] = row_min
+    x[rows, 776 - rows % 100] = row_min
+    x.tofile("./input/input_x.bin")
+    indice, values = top_k(x, 4, 1, False)
+    indice.tofile("./output/golden_indice.bin")
+    values.tofile("./output/golden_values.bin")
+
+
+if __name__ == "__main__":
+    gen_golden_data_simple()